@@ -0,0 +1,17 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief math, arithmetic and conversion functions of the `sg14::fixed_point` type applied to contiguous ranges of values
+/// with vector instructions chosen at run time
+
+#if !defined(SG14_BATCH_H)
+#define SG14_BATCH_H 1
+
+// the batch kernels call the scalar functions so sg14/fixed_point must be complete first
+#include <sg14/fixed_point>
+#include <sg14/bits/fixed_point_batch.h>
+
+#endif  // SG14_BATCH_H
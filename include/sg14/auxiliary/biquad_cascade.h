@@ -0,0 +1,161 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief infinite impulse response filters of `sg14::fixed_point` samples built from second-order sections
+
+#if !defined(SG14_BIQUAD_CASCADE_H)
+#define SG14_BIQUAD_CASCADE_H 1
+
+#include <sg14/auxiliary/elastic_integer.h>
+#include <sg14/auxiliary/batch.h>
+
+#include <cstddef>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    ////////////////////////////////////////////////////////////////////////////////
+    // quantization tags and objects
+
+    // round the output of each section toward negative infinity
+    static constexpr struct truncation_quantization_tag {
+    } truncation_quantization{};
+
+    // add the rounding error of the previous output of each section to its next output,
+    // shaping the rounding noise with a zero at DC
+    static constexpr struct error_feedback_quantization_tag {
+    } error_feedback_quantization{};
+
+    // add twice the rounding error of the previous output of each section less that of the output before it,
+    // shaping the rounding noise with two zeros at DC
+    static constexpr struct noise_shaping_quantization_tag {
+    } noise_shaping_quantization{};
+
+    namespace _impl {
+        namespace biquad {
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::biquad::feedback_order
+
+            // the number of rounding errors of each section fed back to its output
+            template<class Quantization>
+            struct feedback_order;
+
+            template<>
+            struct feedback_order<truncation_quantization_tag> : std::integral_constant<int, 0> {
+            };
+
+            template<>
+            struct feedback_order<error_feedback_quantization_tag> : std::integral_constant<int, 1> {
+            };
+
+            template<>
+            struct feedback_order<noise_shaping_quantization_tag> : std::integral_constant<int, 2> {
+            };
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::biquad::state
+
+            // the integer types of the values calculated by a section; because the output of each section
+            // is saturated, every term is the product of a coefficient and a sample, the sum of a few of them
+            // or a rounding error of fewer digits than the shift from the products to the samples
+            template<class Coeff, class Sample, int FeedbackOrder>
+            struct state {
+                static_assert(std::numeric_limits<typename Coeff::rep>::is_signed
+                              && std::numeric_limits<typename Sample::rep>::is_signed,
+                        "coefficients and samples must be signed");
+
+                // the magnitude of the lowest value of a rep exceeds its maximum by one
+                using coefficient = elastic_integer<digits<typename Coeff::rep>::value+1>;
+                using sample = elastic_integer<digits<typename Sample::rep>::value+1>;
+                using product = decltype(coefficient{}*sample{});
+
+                using s2 = decltype(product{}-product{});
+                using s1 = decltype(product{}-product{}+s2{});
+
+                using error = elastic_integer<(-Coeff::exponent>0) ? -Coeff::exponent : 1>;
+                using feedback = typename std::conditional<FeedbackOrder==2,
+                        decltype(error{}+error{}-error{}), error>::type;
+
+                using accumulator = decltype(product{}+s1{}+feedback{});
+
+                static_assert(accumulator::digits<=std::numeric_limits<fp::working::working_rep>::digits,
+                        "the sum of the products of a section exceeds the working rep");
+
+                // the state and accumulator of every section
+                using rep = set_digits_t<fp::working::working_rep, accumulator::digits>;
+            };
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::biquad_cascade
+
+    /// \brief an infinite impulse response filter of \ref fixed_point samples made of second-order sections
+    ///
+    /// \tparam Coeff the \ref fixed_point type of the coefficients; its exponent must not be positive
+    /// \tparam Sample the \ref fixed_point type of the input and output samples
+    /// \tparam Sections the number of second-order sections applied one after another
+    /// \tparam Channels the number of channels, whose samples are interleaved
+    /// \tparam Quantization one of \ref truncation_quantization_tag, \ref error_feedback_quantization_tag
+    /// and \ref noise_shaping_quantization_tag
+    ///
+    /// \note Each section is evaluated in transposed direct form II. Its state is held in an integer wide enough
+    /// that no sum of products can overflow and its output is saturated to Sample.
+    /// Where Coeff and Sample have 16-bit reps, channels are filtered in parallel with vector instructions.
+    /// The filter holds its state in fixed-size arrays and never allocates.
+    template<class Coeff, class Sample, std::size_t Sections, std::size_t Channels = 1,
+            class Quantization = truncation_quantization_tag>
+    class biquad_cascade {
+        static_assert(Sections>0 && Channels>0, "a cascade must have at least one section and one channel");
+
+        static constexpr int feedback_order = _impl::biquad::feedback_order<Quantization>::value;
+        using _state = _impl::biquad::state<Coeff, Sample, feedback_order>;
+        using _key = _impl::fp::batch::biquad_key<Coeff, Sample, typename _state::rep, Sections, feedback_order>;
+
+    public:
+        using coefficient_type = Coeff;
+        using sample_type = Sample;
+
+        /// the type of the state of each section and its sums of products
+        using state_type = fixed_point<typename _state::rep, Coeff::exponent+Sample::exponent>;
+
+        /// \brief constructs a filter with the given sections and a state of zeros
+        ///
+        /// \param coefficients b0, b1, b2, a1 and a2 of each section
+        /// whose transfer function is (b0 + b1/z + b2/z^2)/(1 + a1/z + a2/z^2)
+        explicit biquad_cascade(const coefficient_type (&coefficients)[Sections][5])
+        {
+            for (auto section = std::size_t{0}; section!=Sections; ++section) {
+                for (auto k = 0; k!=5; ++k) {
+                    _coefficients[section*5+k] = coefficients[section][k];
+                }
+            }
+            reset();
+        }
+
+        /// sets the state of every section to zero
+        void reset()
+        {
+            for (auto& value : _state_values) {
+                value = typename _state::rep{0};
+            }
+        }
+
+        /// \brief filters the frames of interleaved samples, [first, last), whose length is a multiple of Channels
+        ///
+        /// \return end of the output range beginning at d_first, which may be first
+        sample_type* process(const sample_type* first, const sample_type* last, sample_type* d_first)
+        {
+            _impl::dispatch::registry<_key>::selected()(_coefficients, _state_values, Channels, first, last, d_first);
+            return d_first+(last-first);
+        }
+
+    private:
+        coefficient_type _coefficients[Sections*5];
+        typename _state::rep _state_values[Sections*_key::state_count*Channels];
+    };
+}
+
+#endif	// SG14_BIQUAD_CASCADE_H
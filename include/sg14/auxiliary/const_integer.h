@@ -224,6 +224,168 @@ namespace sg14 {
         return _const_integer_impl::operate(lhs, rhs, _impl::divide_tag);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::_const_integer_impl::divide - integer division by a const_integer
+    //
+    // replaces the divide instruction with a multiply-high and shifts;
+    // used by the division operators of types whose rep is known to be narrower than its storage
+
+    namespace _const_integer_impl {
+        // ceil(2^power/divisor) modulo 2^64 by long division; divisor must not exceed 2^63
+        constexpr std::uint64_t magic_ceil(
+                std::uint64_t divisor, int power, std::uint64_t quotient = 0, std::uint64_t remainder = 1)
+        {
+            return (power==0)
+                   ? quotient+(remainder!=0)
+                   : magic_ceil(
+                           divisor, power-1,
+                           (quotient << 1) | ((remainder << 1)>=divisor),
+                           ((remainder << 1)>=divisor) ? (remainder << 1)-divisor : remainder << 1);
+        }
+
+        // the technique used to divide a magnitude of Digits bits by divisor
+        enum class divide_strategy {
+            shift,      // divisor is a power of two
+            compare,    // divisor exceeds 2^63 so the quotient is zero or one
+            multiply,   // n * m fits in 64 bits and s is less than 64
+            multiply_high,  // m fits in 64 bits
+            multiply_high_add   // m is 65 bits wide and its top bit is added back in
+        };
+
+        constexpr divide_strategy get_divide_strategy(std::uint64_t divisor, int digits)
+        {
+            return ((divisor & (divisor-1))==0)
+                   ? divide_strategy::shift
+                   : (divisor>(std::uint64_t{1} << 63))
+                     ? divide_strategy::compare
+                     : (digits<32 && digits+used_bits(divisor-1)<64)
+                       ? divide_strategy::multiply
+                       : (digits<64)
+                         ? divide_strategy::multiply_high
+                         : divide_strategy::multiply_high_add;
+        }
+
+        // exact quotient of an unsigned magnitude of up to Digits bits by Divisor
+        // (Granlund and Montgomery, "Division by Invariant Integers using Multiplication", 1994)
+        template<std::uint64_t Divisor, int Digits, divide_strategy Strategy = get_divide_strategy(Divisor, Digits)>
+        struct magnitude_divider;
+
+        template<std::uint64_t Divisor, int Digits>
+        struct magnitude_divider<Divisor, Digits, divide_strategy::shift> {
+            static constexpr std::uint64_t divide(std::uint64_t n)
+            {
+                return n >> (used_bits(Divisor)-1);
+            }
+        };
+
+        template<std::uint64_t Divisor, int Digits>
+        struct magnitude_divider<Divisor, Digits, divide_strategy::compare> {
+            static constexpr std::uint64_t divide(std::uint64_t n)
+            {
+                return n>=Divisor;
+            }
+        };
+
+        template<std::uint64_t Divisor, int Digits>
+        struct magnitude_divider<Divisor, Digits, divide_strategy::multiply> {
+            static constexpr int shift = Digits+used_bits(Divisor-1);
+
+            static constexpr std::uint64_t divide(std::uint64_t n)
+            {
+                return (n*magic_ceil(Divisor, shift)) >> shift;
+            }
+        };
+
+        template<std::uint64_t Divisor, int Digits>
+        struct magnitude_divider<Divisor, Digits, divide_strategy::multiply_high> {
+            static constexpr int shift = used_bits(Divisor-1);
+
+            static constexpr std::uint64_t divide(std::uint64_t n)
+            {
+                return _impl::multiply_high(n, magic_ceil(Divisor, Digits+shift) << (63-Digits)) >> (shift-1);
+            }
+        };
+
+        template<std::uint64_t Divisor, int Digits>
+        struct magnitude_divider<Divisor, Digits, divide_strategy::multiply_high_add> {
+            static constexpr int shift = used_bits(Divisor-1);
+
+            static constexpr std::uint64_t add(std::uint64_t n, std::uint64_t t)
+            {
+                return (((n-t) >> 1)+t) >> (shift-1);
+            }
+
+            static constexpr std::uint64_t divide(std::uint64_t n)
+            {
+                return add(n, _impl::multiply_high(n, magic_ceil(Divisor, 64+shift)));
+            }
+        };
+
+        template<class Integral>
+        constexpr std::uint64_t magnitude(Integral value)
+        {
+            return (value<0) ? std::uint64_t{0}-static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        }
+
+        // negates a magnitude as large as 2^63 without signed overflow
+        template<class Integer>
+        constexpr Integer apply_sign(bool negative, std::uint64_t quotient)
+        {
+            return (negative && quotient)
+                   ? static_cast<Integer>(-static_cast<Integer>(quotient-1)-1)
+                   : static_cast<Integer>(quotient);
+        }
+
+        // true iff n can be divided with a 64-bit multiply-high
+        // but the built-in operator would call a library routine to divide the full width of Integer
+        template<int Digits, class Integer>
+        struct use_magnitude_divider : std::integral_constant<bool,
+                (Digits<=64) && (std::numeric_limits<Integer>::digits>64)> {
+        };
+
+        // quotient of n, whose magnitude occupies no more than Digits bits, and Value;
+        // rounded toward zero, as by the built-in division operator
+        template<int Digits, class Integral, Integral Value, class Integer, class Enable = void>
+        struct divide {
+            static_assert(Value!=0, "division by zero");
+
+            static constexpr Integer apply(Integer const& n)
+            {
+                return static_cast<Integer>(n/Value);
+            }
+        };
+
+        template<int Digits, class Integral, Integral Value, class Integer>
+        struct divide<Digits, Integral, Value, Integer, _impl::enable_if_t<use_magnitude_divider<Digits, Integer>::value>> {
+            static_assert(Value!=0, "division by zero");
+
+            static constexpr Integer apply(Integer const& n)
+            {
+                return apply_sign<Integer>(
+                        (n<0)!=(Value<0),
+                        magnitude_divider<magnitude(Value), Digits>::divide(magnitude(n)));
+            }
+        };
+
+        // number of bits needed to store the magnitude of any value of Integer
+        template<class Integer>
+        constexpr int magnitude_digits()
+        {
+            return digits<Integer>::value+(std::numeric_limits<Integer>::is_signed
+                    && std::numeric_limits<Integer>::lowest()<-std::numeric_limits<Integer>::max());
+        }
+
+        // divides the rep of an integer of fundamental or number_base type;
+        // the compiler already strength-reduces the built-in operator for widths up to 64 bits
+        template<class Integer, class Integral, Integral Value, int RhsDigits, int RhsExponent>
+        constexpr Integer divide_integer(Integer const& n, const_integer<Integral, Value, RhsDigits, RhsExponent>)
+        {
+            return _impl::from_rep<Integer>(divide<
+                    magnitude_digits<Integer>(),
+                    Integral, Value, typename std::decay<decltype(_impl::to_rep(n))>::type>::apply(_impl::to_rep(n)));
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     // sg14::const_integer comparison operator overloads
 
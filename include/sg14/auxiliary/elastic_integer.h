@@ -71,7 +71,6 @@ namespace sg14 {
         using _value_type = elastic_integer<Digits, Narrowest>;
 
         constexpr _value_type operator()(const _value_type& i, int base, int exp) const {
-            using _rep = typename _value_type::rep;
             return _value_type{ _impl::scale(i.data(), base, exp) };
         }
     };
@@ -396,6 +395,21 @@ namespace sg14 {
         using result_type = elastic_integer<RhsDigits, typename make_signed<RhsNarrowest>::type>;
         return result_type::from_data(static_cast<result_type>(rhs).data());
     }
+
+    // operator/ with const_integer divisor;
+    // divides the LhsDigits-bit magnitude with a multiply-high even when the rep is wider than 64 bits
+    template<int LhsDigits, class LhsNarrowest, class RhsIntegral, RhsIntegral RhsValue, int RhsDigits, int RhsExponent>
+    constexpr auto operator/(
+            const elastic_integer<LhsDigits, LhsNarrowest>& lhs,
+            const const_integer<RhsIntegral, RhsValue, RhsDigits, RhsExponent>& rhs)
+    -> decltype(_impl::operate(lhs, rhs, _impl::divide_tag))
+    {
+        using result_type = decltype(_impl::operate(lhs, rhs, _impl::divide_tag));
+        using result_rep = typename result_type::rep;
+        return result_type::from_data(_const_integer_impl::divide<
+                LhsDigits,
+                RhsIntegral, RhsValue, result_rep>::apply(static_cast<result_rep>(lhs.data())));
+    }
 }
 
 namespace std {
@@ -0,0 +1,1242 @@
+//          Copyright Heikki Berg 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief fast Fourier transforms of complex `sg14::fixed_point` values
+
+#if !defined(SG14_FFT_H)
+#define SG14_FFT_H 1
+
+#include <sg14/auxiliary/batch.h>
+#include <sg14/auxiliary/numeric.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    /// \brief the alignment in bytes of the buffers passed to the transforms at which they are fastest
+    constexpr std::size_t fft_alignment = 64;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // in-place FFT algorithm tags and objects
+
+    // pairs of values combined in log2(N) passes; the default
+    static constexpr struct radix_2_tag {
+    } radix_2{};
+
+    // quartets of values combined in log4(N) passes, each with three complex multiplications per quartet
+    // where two radix-2 passes take four; where log2(N) is odd, the first pass is radix-2
+    static constexpr struct radix_4_tag {
+    } radix_4{};
+
+    // decimation in frequency with radix-2 for the even outputs and radix-4 for the odd outputs,
+    // taking the fewest multiplications of a power-of-two FFT
+    static constexpr struct split_radix_tag {
+    } split_radix{};
+
+    namespace _impl {
+        namespace fft {
+            // converts a factor in [-1, 1] to T; where 1 is out of range of T, as in Q15 and Q31,
+            // it is saturated to the greatest value of T rather than wrapping to -1
+            template<class T>
+            T factor(double value)
+            {
+                return (value>=static_cast<double>(std::numeric_limits<T>::max()))
+                       ? std::numeric_limits<T>::max()
+                       : static_cast<T>(value);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fft_plan
+
+    /// \brief the twiddle factors and stage count of transforms of a given power-of-two size
+    ///
+    /// \tparam T the type of the real and imaginary parts of the values transformed
+    ///
+    /// \note The twiddle factors are calculated in double precision once, on construction;
+    /// a plan may then be used by any number of transforms, concurrently, without allocation
+    /// or floating-point arithmetic.
+    /// Where T cannot represent 1, as in Q15 and Q31, factors of 1 are the greatest value of T.
+    template<class T>
+    class fft_plan {
+    public:
+        using value_type = std::complex<T>;
+
+        /// \brief constructs a plan of transforms of size values, which must be a power of two
+        explicit fft_plan(std::size_t size)
+                :_size(size), _stages(0)
+        {
+            while ((std::size_t{1} << _stages)<size) {
+                ++_stages;
+            }
+
+            auto const half = size/2;
+            _twiddles.reserve(half);
+            for (auto k = std::size_t{0}; k!=half; ++k) {
+                auto const angle = 3.14159265358979323846*static_cast<double>(k)/static_cast<double>(half);
+                _twiddles.emplace_back(_impl::fft::factor<T>(std::cos(angle)), _impl::fft::factor<T>(-std::sin(angle)));
+            }
+        }
+
+        /// the number of values transformed
+        std::size_t size() const
+        {
+            return _size;
+        }
+
+        /// the number of radix-2 stages, log2(size())
+        int stages() const
+        {
+            return _stages;
+        }
+
+        /// \brief e^(-2 pi i k / size()) for k in [0, size()/2)
+        const value_type& twiddle(std::size_t k) const
+        {
+            return _twiddles[k];
+        }
+
+    private:
+        std::size_t _size;
+        int _stages;
+        std::vector<value_type> _twiddles;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::rfft_plan
+
+    /// \brief the plans of transforms of a given power-of-two number of real values
+    ///
+    /// \tparam T the type of the values transformed
+    ///
+    /// \note The N real values are transformed as N/2 complex values whose parts are the even and odd values,
+    /// followed by a pass which splits the transforms of the even and odd values apart.
+    /// The factors of that pass, A(k) = (1 - i e^(-2 pi i k / N))/2 and B(k) = (1 + i e^(-2 pi i k / N))/2,
+    /// are calculated in double precision once, on construction, like the twiddle factors;
+    /// where T cannot represent B(size()/4) = 1, it is the greatest value of T.
+    template<class T>
+    class rfft_plan {
+    public:
+        using value_type = std::complex<T>;
+
+        /// \brief constructs a plan of transforms of size real values, which must be a power of two of at least 2
+        explicit rfft_plan(std::size_t size)
+                :_size(size), _half(size/2)
+        {
+            auto const quarter = size/4;
+            _split.reserve(2*(quarter+1));
+            for (auto k = std::size_t{0}; k<=quarter; ++k) {
+                auto const angle = 2.*3.14159265358979323846*static_cast<double>(k)/static_cast<double>(size);
+                auto const sine = std::sin(angle);
+                auto const cosine = std::cos(angle);
+                _split.emplace_back(_impl::fft::factor<T>((1.-sine)/2.), _impl::fft::factor<T>(-cosine/2.));
+                _split.emplace_back(_impl::fft::factor<T>((1.+sine)/2.), _impl::fft::factor<T>(cosine/2.));
+            }
+        }
+
+        /// the number of real values transformed
+        std::size_t size() const
+        {
+            return _size;
+        }
+
+        /// the plan of the transforms of size()/2 complex values
+        const fft_plan<T>& half() const
+        {
+            return _half;
+        }
+
+        /// \brief A(k) for k in [0, size()/4]; A(size()/2-k) is its conjugate
+        const value_type& split_a(std::size_t k) const
+        {
+            return _split[2*k];
+        }
+
+        /// \brief B(k) for k in [0, size()/4]; B(size()/2-k) is its conjugate
+        const value_type& split_b(std::size_t k) const
+        {
+            return _split[2*k+1];
+        }
+
+    private:
+        std::size_t _size;
+        fft_plan<T> _half;
+        std::vector<value_type> _split;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fft_thread_pool
+
+    /// \brief a calling thread and persistent workers among which batches of transforms and the stages
+    /// of parallel transforms are divided
+    ///
+    /// \note The workers are started once, on construction, and wait between jobs, so that the transforms
+    /// given a pool neither start threads nor allocate. A pool runs the jobs of one calling thread at a time.
+    class fft_thread_pool {
+    public:
+        /// \brief starts threads-1 workers; the thread which calls a transform is the other
+        explicit fft_thread_pool(unsigned threads)
+        {
+            auto const workers = std::max(threads, 1u)-1;
+            _workers.reserve(workers);
+#if defined(SG14_EXCEPTIONS_ENABLED)
+            try {
+#endif
+                for (auto band = 1u; band<=workers; ++band) {
+                    _workers.emplace_back(&fft_thread_pool::work, this, band);
+                }
+#if defined(SG14_EXCEPTIONS_ENABLED)
+            }
+            catch (...) {
+                stop();
+                throw;
+            }
+#endif
+        }
+
+        fft_thread_pool(const fft_thread_pool&) = delete;
+        fft_thread_pool& operator=(const fft_thread_pool&) = delete;
+
+        /// stops and joins the workers
+        ~fft_thread_pool()
+        {
+            stop();
+        }
+
+        /// the number of threads, including the calling thread
+        unsigned size() const
+        {
+            return static_cast<unsigned>(_workers.size())+1;
+        }
+
+        /// \brief calls function(band) for each band in [0, bands), at most size(), each on its own thread,
+        /// and returns once all have returned; band 0 is called on the calling thread
+        ///
+        /// \note Where a call throws, the first exception is rethrown once all have returned.
+        template<class Function>
+        void run(std::size_t bands, const Function& function)
+        {
+            if (bands<=1) {
+                if (bands) {
+                    function(std::size_t{0});
+                }
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _context = &function;
+                _invoke = &invoke<Function>;
+                _bands = bands;
+                _pending = bands-1;
+                ++_generation;
+            }
+            _start.notify_all();
+
+#if defined(SG14_EXCEPTIONS_ENABLED)
+            try {
+#endif
+                function(std::size_t{0});
+#if defined(SG14_EXCEPTIONS_ENABLED)
+            }
+            catch (...) {
+                wait();
+                throw;
+            }
+#endif
+            wait();
+        }
+
+    private:
+        template<class Function>
+        static void invoke(const void* context, std::size_t band)
+        {
+            (*static_cast<const Function*>(context))(band);
+        }
+
+        // waits for the workers to finish the current job and rethrows the first exception of any of them
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock, [this] { return _pending==0; });
+#if defined(SG14_EXCEPTIONS_ENABLED)
+            if (_exception) {
+                auto exception = _exception;
+                _exception = nullptr;
+                std::rethrow_exception(exception);
+            }
+#endif
+        }
+
+        // calls band of each job whose bands include it until the pool is stopped
+        void work(std::size_t band)
+        {
+            auto generation = std::size_t{0};
+            std::unique_lock<std::mutex> lock(_mutex);
+            for (;;) {
+                _start.wait(lock, [&] { return _stopping || _generation!=generation; });
+                if (_stopping) {
+                    return;
+                }
+                generation = _generation;
+                if (band>=_bands) {
+                    continue;
+                }
+
+                auto const invoke = _invoke;
+                auto const context = _context;
+                lock.unlock();
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                try {
+#endif
+                    invoke(context, band);
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                }
+                catch (...) {
+                    lock.lock();
+                    if (!_exception) {
+                        _exception = std::current_exception();
+                    }
+                    lock.unlock();
+                }
+#endif
+                lock.lock();
+                if (--_pending==0) {
+                    _done.notify_one();
+                }
+            }
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _start.notify_all();
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+        }
+
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _start;
+        std::condition_variable _done;
+        const void* _context = nullptr;
+        void (* _invoke)(const void*, std::size_t) = nullptr;
+        std::size_t _bands = 0;
+        std::size_t _pending = 0;
+        std::size_t _generation = 0;
+        bool _stopping = false;
+#if defined(SG14_EXCEPTIONS_ENABLED)
+        std::exception_ptr _exception;
+#endif
+    };
+
+    namespace _impl {
+        namespace fft {
+            ////////////////////////////////////////////////////////////////////////////////
+            // arithmetic of complex values whose parts are fixed_point values,
+            // each product calculated at full width before it is summed and converted
+
+            template<class T>
+            std::complex<T> product(const std::complex<T>& w, const std::complex<T>& x)
+            {
+                return w*x;
+            }
+
+            template<class Rep, int Exponent>
+            std::complex<fixed_point<Rep, Exponent>> product(
+                    const std::complex<fixed_point<Rep, Exponent>>& w, const std::complex<fixed_point<Rep, Exponent>>& x)
+            {
+                return fp::batch::complex_product(w, x);
+            }
+
+            template<class T>
+            std::complex<T> sum(const std::complex<T>& lhs, const std::complex<T>& rhs)
+            {
+                return fp::batch::complex_sum(lhs, rhs);
+            }
+
+            template<class T>
+            std::complex<T> difference(const std::complex<T>& lhs, const std::complex<T>& rhs)
+            {
+                return fp::batch::complex_difference(lhs, rhs);
+            }
+
+            // the twiddle factor of the given direction
+            template<class T>
+            std::complex<T> twiddle(const fft_plan<T>& plan, std::size_t k, bool inverse)
+            {
+                return fp::batch::twiddle_factor(&plan.twiddle(0), k, inverse);
+            }
+
+            // the twiddle factor of the given direction for k in [0, plan.size()),
+            // using e^(-2 pi i (k + N/2) / N) = -e^(-2 pi i k / N)
+            template<class T>
+            std::complex<T> twiddle_power(const fft_plan<T>& plan, std::size_t k, bool inverse)
+            {
+                auto const half = plan.size()/2;
+                if (k<half) {
+                    return twiddle(plan, k, inverse);
+                }
+                auto const w = twiddle(plan, k-half, inverse);
+                return std::complex<T>(static_cast<T>(-w.real()), static_cast<T>(-w.imag()));
+            }
+
+            // the value multiplied by -i or, in the inverse direction, by i
+            template<class T>
+            std::complex<T> quarter_turn(const std::complex<T>& x, bool inverse)
+            {
+                return inverse
+                       ? std::complex<T>(static_cast<T>(-x.imag()), x.real())
+                       : std::complex<T>(x.imag(), static_cast<T>(-x.real()));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // scaling between the passes of the in-place algorithms
+
+            // leaves the values as they are
+            struct unscaled {
+                template<class T>
+                int operator()(std::complex<T>*, std::size_t, int) const
+                {
+                    return 0;
+                }
+            };
+
+            // shifts the values so that the largest magnitude leaves headroom integer bits clear
+            // and returns the shift; see normalize
+            struct block_scaled {
+                template<class T>
+                int operator()(std::complex<T>* data, std::size_t n, int headroom) const;
+            };
+
+            // the in-place algorithm with the given tag
+            template<class Algorithm>
+            struct is_algorithm : std::false_type {
+            };
+
+            template<>
+            struct is_algorithm<radix_2_tag> : std::true_type {
+            };
+
+            template<>
+            struct is_algorithm<radix_4_tag> : std::true_type {
+            };
+
+            template<>
+            struct is_algorithm<split_radix_tag> : std::true_type {
+            };
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::stockham
+
+            // one radix-2 pass of the Stockham autosort FFT from y to x
+            template<class T>
+            void stockham_pass(const fft_plan<T>& plan, const std::complex<T>* y, std::complex<T>* x, int q, bool inverse)
+            {
+                auto const n = plan.size();
+                auto const l_s = std::size_t{1} << (q-1);
+                auto const r = n >> q;
+                auto const r_s = n >> (q-1);
+                for (auto j = std::size_t{0}; j!=l_s; ++j) {
+                    auto const w = twiddle(plan, j*r, inverse);
+                    for (auto k = std::size_t{0}; k!=r; ++k) {
+                        auto const tau = product(w, y[j*r_s+k+r]);
+                        x[j*r+k] = sum(y[j*r_s+k], tau);
+                        x[(j+l_s)*r+k] = difference(y[j*r_s+k], tau);
+                    }
+                }
+            }
+
+            // passes over values with 16- and 32-bit parts are made with the vector instructions
+            // of selected_instruction_set()
+            template<class Rep, int Exponent>
+            void stockham_pass(
+                    const fft_plan<fixed_point<Rep, Exponent>>& plan, const std::complex<fixed_point<Rep, Exponent>>* y,
+                    std::complex<fixed_point<Rep, Exponent>>* x, int q, bool inverse)
+            {
+                dispatch::registry<fp::batch::stockham_key<Rep, Exponent>>::selected()(
+                        &plan.twiddle(0), plan.size(), q, inverse, y, x);
+            }
+
+            // Stockham autosort FFT;
+            // Reference: "Computational Frameworks for the Fast Fourier Transform",
+            // Charles Van Loan, SIAM, 1992. Algorithm 1.7.2. pp. 56-57.
+            template<class T>
+            std::complex<T>* stockham(
+                    const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work, bool inverse)
+            {
+                auto y = data;
+                auto x = work;
+                for (auto q = 1; q<=plan.stages(); ++q) {
+                    stockham_pass(plan, y, x, q, inverse);
+                    std::swap(x, y);
+                }
+                return y;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::cooley_tukey
+
+            // exchanges each value at an index in [first, last) with the value at the bit-reversed index
+            // where that is the greater; the ranges of concurrent calls must not overlap
+            template<class T>
+            void reorder(std::complex<T>* data, std::size_t n, std::size_t first, std::size_t last)
+            {
+                auto j = std::size_t{0};
+                for (auto i = first, bit = n/2; i!=0; i /= 2, bit /= 2) {
+                    j |= (i & 1) ? bit : 0;
+                }
+                for (auto i = first; i!=last; ++i) {
+                    if (i<j) {
+                        std::swap(data[i], data[j]);
+                    }
+
+                    // add one to the most significant bit of j and carry downward
+                    auto k = n/2;
+                    while (j & k) {
+                        j ^= k;
+                        k /= 2;
+                    }
+                    j |= k;
+                }
+            }
+
+            // exchanges each value with the value at the bit-reversed index
+            template<class T>
+            void reorder(std::complex<T>* data, std::size_t n)
+            {
+                reorder(data, n, 0, n);
+            }
+
+            // butterflies [first, last) of one radix-2 stage of the in-place Cooley-Tukey FFT;
+            // see fp::batch::butterflies
+            template<class T>
+            void cooley_tukey_stage(
+                    const fft_plan<T>& plan, std::complex<T>* data, int q, bool inverse,
+                    std::size_t first, std::size_t last)
+            {
+                auto const l = std::size_t{1} << q;
+                auto const l_s = std::size_t{1} << (q-1);
+                auto const r = plan.size() >> q;
+                auto const block = fp::batch::butterflies(first, last, l_s);
+                for (auto j = block.column_first; j!=block.column_last; ++j) {
+                    auto const w = twiddle(plan, j*r, inverse);
+                    for (auto k = block.row_first; k!=block.row_last; ++k) {
+                        auto const tau = product(w, data[k*l+j+l_s]);
+                        data[k*l+j+l_s] = difference(data[k*l+j], tau);
+                        data[k*l+j] = sum(data[k*l+j], tau);
+                    }
+                }
+            }
+
+            // stages over values with 16- and 32-bit parts are made with the vector instructions
+            // of selected_instruction_set()
+            template<class Rep, int Exponent>
+            void cooley_tukey_stage(
+                    const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+                    int q, bool inverse, std::size_t first, std::size_t last)
+            {
+                dispatch::registry<fp::batch::cooley_tukey_key<Rep, Exponent>>::selected()(
+                        &plan.twiddle(0), plan.size(), q, inverse, first, last, data);
+            }
+
+            // the radix-2 in-place FFT, scaled before each pass; returns the sum of the scales
+            template<class T, class Scaling>
+            int transform(
+                    const fft_plan<T>& plan, std::complex<T>* data, bool inverse, Scaling scaling, radix_2_tag)
+            {
+                auto total_scale = 0;
+                reorder(data, plan.size());
+                for (auto q = 1; q<=plan.stages(); ++q) {
+                    total_scale += scaling(data, plan.size(), (q>2) ? 2 : 1);
+                    cooley_tukey_stage(plan, data, q, inverse, 0, plan.size()/2);
+                }
+                return total_scale;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::radix_4
+
+            // stages q and q+1 of the in-place Cooley-Tukey FFT fused into one radix-4 stage;
+            // each quartet combines four transforms of 2^(q-1) values into one of 2^(q+1) values
+            template<class T>
+            void radix_4_stage(const fft_plan<T>& plan, std::complex<T>* data, int q, bool inverse)
+            {
+                auto const n = plan.size();
+                auto const l_s = std::size_t{1} << (q-1);
+                auto const l = l_s*4;
+                auto const r = n >> (q+1);
+                for (auto j = std::size_t{0}; j!=l_s; ++j) {
+                    auto const w1 = twiddle_power(plan, j*r, inverse);
+                    auto const w2 = twiddle_power(plan, j*r*2, inverse);
+                    auto const w3 = twiddle_power(plan, j*r*3, inverse);
+                    for (auto k = j; k<n; k += l) {
+                        auto const t0 = data[k];
+                        auto const t1 = product(w2, data[k+l_s]);
+                        auto const t2 = product(w1, data[k+l_s*2]);
+                        auto const t3 = product(w3, data[k+l_s*3]);
+                        auto const u0 = sum(t0, t1);
+                        auto const u1 = difference(t0, t1);
+                        auto const u2 = sum(t2, t3);
+                        auto const u3 = quarter_turn(difference(t2, t3), inverse);
+                        data[k] = sum(u0, u2);
+                        data[k+l_s] = sum(u1, u3);
+                        data[k+l_s*2] = difference(u0, u2);
+                        data[k+l_s*3] = difference(u1, u3);
+                    }
+                }
+            }
+
+            // the radix-4 in-place FFT; the sums of the products of a quartet with nontrivial twiddle factors
+            // grow by as much as 1+3*sqrt(2), so the values are scaled to leave one more bit clear than radix-2
+            template<class T, class Scaling>
+            int transform(
+                    const fft_plan<T>& plan, std::complex<T>* data, bool inverse, Scaling scaling, radix_4_tag)
+            {
+                auto total_scale = 0;
+                reorder(data, plan.size());
+                auto q = 1;
+                if (plan.stages()%2) {
+                    total_scale += scaling(data, plan.size(), 1);
+                    cooley_tukey_stage(plan, data, q++, inverse, 0, plan.size()/2);
+                }
+                for (; q<plan.stages(); q += 2) {
+                    total_scale += scaling(data, plan.size(), (q>1) ? 3 : 2);
+                    radix_4_stage(plan, data, q, inverse);
+                }
+                return total_scale;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::split_radix
+
+            // Split-radix in-place FFT;
+            // Reference: "On Computing the Split-Radix FFT", H.V. Sorensen, M.T. Heideman and C.S. Burrus,
+            // IEEE Transactions on Acoustics, Speech, and Signal Processing, 1986.
+            // Each pass applies an L-shaped butterfly to every block of n2 values that is yet to be transformed:
+            // the first half becomes the input of a transform of the even outputs, each remaining quarter
+            // that of a transform of the outputs at 4k+1 or 4k+3. The sums multiplied by the twiddle factors
+            // grow by as much as 4*sqrt(2), so the values are scaled like those of radix-4.
+            template<class T, class Scaling>
+            int transform(
+                    const fft_plan<T>& plan, std::complex<T>* data, bool inverse, Scaling scaling, split_radix_tag)
+            {
+                auto const n = plan.size();
+                auto total_scale = 0;
+                for (auto n2 = n; n2>2; n2 /= 2) {
+                    auto const n4 = n2/4;
+                    auto const r = n/n2;
+                    total_scale += scaling(data, n, 3);
+                    for (auto j = std::size_t{0}; j!=n4; ++j) {
+                        auto const w1 = twiddle_power(plan, j*r, inverse);
+                        auto const w3 = twiddle_power(plan, j*r*3, inverse);
+                        for (auto first = j, step = n2*2; first<n; first = step*2-n2+j, step *= 4) {
+                            for (auto i0 = first; i0<n; i0 += step) {
+                                auto const i1 = i0+n4;
+                                auto const i2 = i1+n4;
+                                auto const i3 = i2+n4;
+                                auto const a = difference(data[i0], data[i2]);
+                                auto const b = quarter_turn(difference(data[i1], data[i3]), inverse);
+                                data[i0] = sum(data[i0], data[i2]);
+                                data[i1] = sum(data[i1], data[i3]);
+                                data[i2] = product(w1, sum(a, b));
+                                data[i3] = product(w3, difference(a, b));
+                            }
+                        }
+                    }
+                }
+
+                if (n>1) {
+                    total_scale += scaling(data, n, 1);
+                    for (auto first = std::size_t{0}, step = std::size_t{4}; first<n; first = step*2-2, step *= 4) {
+                        for (auto i0 = first; i0<n; i0 += step) {
+                            auto const x0 = data[i0];
+                            data[i0] = sum(x0, data[i0+1]);
+                            data[i0+1] = difference(x0, data[i0+1]);
+                        }
+                    }
+                }
+
+                reorder(data, n);
+                return total_scale;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::block_scaled
+
+            template<class Rep, int Exponent>
+            fixed_point<Rep, Exponent> find_max(const std::complex<fixed_point<Rep, Exponent>>* data, std::size_t n)
+            {
+                auto max = fixed_point<Rep, Exponent>{0};
+                for (auto i = std::size_t{0}; i!=n; ++i) {
+                    if (abs(data[i].real())>max) {
+                        max = abs(data[i].real());
+                    }
+                    if (abs(data[i].imag())>max) {
+                        max = abs(data[i].imag());
+                    }
+                }
+                return max;
+            }
+
+            // shifts the values so that the largest magnitude leaves adjustment integer bits clear
+            // and returns the shift
+            template<class Rep, int Exponent>
+            int normalize(std::complex<fixed_point<Rep, Exponent>>* data, std::size_t n, int adjustment)
+            {
+                using part = fixed_point<Rep, Exponent>;
+                auto const max = find_max(data, n);
+                auto const norm = leading_bits(max)-part::integer_digits-adjustment;
+                for (auto i = std::size_t{0}; i!=n; ++i) {
+                    data[i] = (norm<0)
+                              ? std::complex<part>(data[i].real() >> -norm, data[i].imag() >> -norm)
+                              : std::complex<part>(data[i].real() << norm, data[i].imag() << norm);
+                }
+                return norm;
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::split
+
+            // the transform, X, of N real values from the transform, Z, of the N/2 complex values
+            // whose parts are the even and odd values, X(k) = Z(k)A(k) + conj(Z(N/2-k))B(k),
+            // with X(0) and X(N/2), which are real, packed into the first value
+            template<class T>
+            void split(const rfft_plan<T>& plan, std::complex<T>* data)
+            {
+                auto const m = plan.size()/2;
+                auto const z0 = data[0];
+                data[0] = std::complex<T>(
+                        static_cast<T>(z0.real()+z0.imag()), static_cast<T>(z0.real()-z0.imag()));
+                for (auto k = std::size_t{1}; k<=m/2; ++k) {
+                    auto const zk = data[k];
+                    auto const zmk = std::conj(data[m-k]);
+                    data[k] = sum(product(plan.split_a(k), zk), product(plan.split_b(k), zmk));
+                    data[m-k] = std::conj(sum(product(plan.split_a(k), zmk), product(plan.split_b(k), zk)));
+                }
+            }
+
+            // the inverse of split, Z(k) = X(k)conj(A(k)) + conj(X(N/2-k))conj(B(k)), which is half of Z
+            template<class T>
+            void merge(const rfft_plan<T>& plan, std::complex<T>* data)
+            {
+                auto const m = plan.size()/2;
+                auto const x0 = std::complex<T>(data[0].real(), T{0});
+                auto const xm = std::complex<T>(data[0].imag(), T{0});
+                data[0] = sum(product(std::conj(plan.split_a(0)), x0), product(std::conj(plan.split_b(0)), xm));
+                for (auto k = std::size_t{1}; k<=m/2; ++k) {
+                    auto const xk = data[k];
+                    auto const xmk = std::conj(data[m-k]);
+                    data[k] = sum(product(std::conj(plan.split_a(k)), xk), product(std::conj(plan.split_b(k)), xmk));
+                    data[m-k] = std::conj(
+                            sum(product(std::conj(plan.split_a(k)), xmk), product(std::conj(plan.split_b(k)), xk)));
+                }
+            }
+
+            // the even and odd values as the parts of complex values
+            template<class T>
+            void pack(const T* first, std::size_t n, std::complex<T>* d_first)
+            {
+                for (auto i = std::size_t{0}; i!=n/2; ++i) {
+                    d_first[i] = std::complex<T>(first[2*i], first[2*i+1]);
+                }
+            }
+
+            template<class T>
+            void unpack(const std::complex<T>* first, std::size_t n, T* d_first)
+            {
+                for (auto i = std::size_t{0}; i!=n/2; ++i) {
+                    d_first[2*i] = first[i].real();
+                    d_first[2*i+1] = first[i].imag();
+                }
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fft::parallel_for
+
+            // calls function(band, first, last) for each band, [first, last), of [0, count) divided among
+            // the threads of pool; the first band is processed by the calling thread
+            template<class Function>
+            void parallel_for(fft_thread_pool& pool, std::size_t count, const Function& function)
+            {
+                auto const band = (count+pool.size()-1)/pool.size();
+                auto const bands = band ? (count+band-1)/band : 0;
+                pool.run(bands, [&](std::size_t index) {
+                    function(index, index*band, std::min((index+1)*band, count));
+                });
+            }
+
+            // count transforms of consecutive runs of plan.size() values in place divided among the threads
+            // of pool, storing the sum of the scales of each in exponents, unless it is null
+            template<class T, class Scaling, class Algorithm>
+            void batch_transform(
+                    const fft_plan<T>& plan, std::complex<T>* data, std::size_t count, bool inverse, Scaling scaling,
+                    Algorithm algorithm, int* exponents, fft_thread_pool& pool)
+            {
+                parallel_for(pool, count, [=, &plan](std::size_t, std::size_t first, std::size_t last) {
+                    for (auto i = first; i!=last; ++i) {
+                        auto const exponent = transform(plan, data+i*plan.size(), inverse, scaling, algorithm);
+                        if (exponents) {
+                            exponents[i] = exponent;
+                        }
+                    }
+                });
+            }
+
+            // count Stockham transforms of consecutive runs of plan.size() values divided among the threads
+            // of pool, each with its own plan.size() values of work; where a transform ends in work,
+            // it is copied back
+            template<class T>
+            void batch_stockham(
+                    const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work, std::size_t count,
+                    bool inverse, fft_thread_pool& pool)
+            {
+                parallel_for(pool, count, [=, &plan](std::size_t band, std::size_t first, std::size_t last) {
+                    auto const n = plan.size();
+                    for (auto i = first; i!=last; ++i) {
+                        auto const output = stockham(plan, data+i*n, work+band*n, inverse);
+                        if (output!=data+i*n) {
+                            std::copy(output, output+n, data+i*n);
+                        }
+                    }
+                });
+            }
+
+            // the fewest values of a parallel transform given to each thread;
+            // the stages over fewer values are left to a single thread
+            constexpr std::size_t parallel_part = std::size_t{1} << 16;
+
+            // the largest power of two no greater than threads into which n values divide
+            // in parts of at least parallel_part values
+            inline unsigned parallel_parts(std::size_t n, unsigned threads)
+            {
+                auto parts = 1u;
+                while (parts*2<=threads && n/(parts*2)>=parallel_part) {
+                    parts *= 2;
+                }
+                return parts;
+            }
+
+            // the radix-2 in-place FFT with the values divided among a power-of-two number of the threads
+            // of pool, parts, each of at least parallel_part values; the stages which combine values within
+            // a part are made by its thread without waiting for the others and the last log2(parts) stages
+            // are divided among the threads one stage at a time, each job of the pool ending in a barrier
+            template<class T>
+            void parallel_transform(
+                    const fft_plan<T>& plan, std::complex<T>* data, bool inverse, fft_thread_pool& pool)
+            {
+                auto const n = plan.size();
+                auto const parts = parallel_parts(n, pool.size());
+                auto part_stages = plan.stages();
+                for (auto p = parts; p>1; p /= 2) {
+                    --part_stages;
+                }
+                auto const part = n/parts;
+
+                parallel_for(pool, parts, [=](std::size_t, std::size_t first, std::size_t last) {
+                    reorder(data, n, first*part, last*part);
+                });
+                parallel_for(pool, parts, [=, &plan](std::size_t, std::size_t first, std::size_t last) {
+                    for (auto q = 1; q<=part_stages; ++q) {
+                        cooley_tukey_stage(plan, data, q, inverse, first*part/2, last*part/2);
+                    }
+                });
+                for (auto q = part_stages+1; q<=plan.stages(); ++q) {
+                    parallel_for(pool, parts, [=, &plan](std::size_t, std::size_t first, std::size_t last) {
+                        cooley_tukey_stage(plan, data, q, inverse, first*part/2, last*part/2);
+                    });
+                }
+            }
+
+            // before each pass of the in-place FFT, the values are normalized to maximize the SNR of the pass
+            // for a limited word length accumulator as described in "A Block Floating Point Implementation
+            // for an N-Point FFT on the TMS320C55x DSP"
+            template<class T>
+            int block_scaled::operator()(std::complex<T>* data, std::size_t n, int headroom) const
+            {
+                return normalize(data, n, headroom);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fft and sg14::ifft
+
+    /// \brief calculates the discrete Fourier transform of plan.size() values
+    /// with the Stockham autosort algorithm
+    ///
+    /// \param data the input, which is overwritten
+    /// \param work a buffer of plan.size() values
+    ///
+    /// \return data or work, whichever holds the output
+    template<class T>
+    std::complex<T>* fft(const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work)
+    {
+        return _impl::fft::stockham(plan, data, work, false);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transform of plan.size() values
+    /// with the Stockham autosort algorithm
+    ///
+    /// \return data or work, whichever holds the output
+    template<class T>
+    std::complex<T>* ifft(const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work)
+    {
+        return _impl::fft::stockham(plan, data, work, true);
+    }
+
+    /// \brief calculates the discrete Fourier transform of plan.size() values in place
+    /// with the Cooley-Tukey algorithm
+    ///
+    /// \tparam Algorithm one of \ref radix_2_tag, \ref radix_4_tag and \ref split_radix_tag
+    template<class T, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void fft(const fft_plan<T>& plan, std::complex<T>* data, Algorithm algorithm = Algorithm{})
+    {
+        _impl::fft::transform(plan, data, false, _impl::fft::unscaled{}, algorithm);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transform of plan.size() values in place
+    /// with the Cooley-Tukey algorithm
+    ///
+    /// \tparam Algorithm one of \ref radix_2_tag, \ref radix_4_tag and \ref split_radix_tag
+    template<class T, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void ifft(const fft_plan<T>& plan, std::complex<T>* data, Algorithm algorithm = Algorithm{})
+    {
+        _impl::fft::transform(plan, data, true, _impl::fft::unscaled{}, algorithm);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::block_fft and sg14::block_ifft
+
+    /// \brief calculates the discrete Fourier transform of plan.size() values in place
+    /// with block floating point arithmetic
+    ///
+    /// \tparam Algorithm one of \ref radix_2_tag, \ref radix_4_tag and \ref split_radix_tag
+    ///
+    /// \return the exponent, e, such that the transform is the output multiplied by 2^-e
+    ///
+    /// \note Before each pass, the values are shifted so that the largest magnitude is as large as it can be
+    /// without the butterflies of the pass overflowing.
+    template<class Rep, int Exponent, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    int block_fft(const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            Algorithm algorithm = Algorithm{})
+    {
+        return _impl::fft::transform(plan, data, false, _impl::fft::block_scaled{}, algorithm);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transform of plan.size() values in place
+    /// with block floating point arithmetic
+    ///
+    /// \return the exponent, e, such that the transform is the output multiplied by 2^-e
+    template<class Rep, int Exponent, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    int block_ifft(const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            Algorithm algorithm = Algorithm{})
+    {
+        return _impl::fft::transform(plan, data, true, _impl::fft::block_scaled{}, algorithm);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::rfft and sg14::irfft
+
+    /// \brief calculates the discrete Fourier transform, X, of plan.size() real values
+    ///
+    /// \param input the plan.size() real values
+    /// \param output plan.size()/2 values: X(0) and X(N/2), which are real, as the parts of the first
+    /// followed by X(1) to X(N/2-1); the transform of the remaining values is their conjugate
+    ///
+    /// \note The values are transformed in place with the radix-2 algorithm as plan.size()/2 complex values.
+    template<class T>
+    void rfft(const rfft_plan<T>& plan, const T* input, std::complex<T>* output)
+    {
+        _impl::fft::pack(input, plan.size(), output);
+        fft(plan.half(), output);
+        _impl::fft::split(plan, output);
+    }
+
+    /// \brief calculates half the unscaled inverse discrete Fourier transform of plan.size() values
+    /// whose transform is real
+    ///
+    /// \param data the output of rfft, which is overwritten
+    /// \param output the plan.size() real values multiplied by plan.size()/2
+    template<class T>
+    void irfft(const rfft_plan<T>& plan, std::complex<T>* data, T* output)
+    {
+        _impl::fft::merge(plan, data);
+        ifft(plan.half(), data);
+        _impl::fft::unpack(data, plan.size(), output);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::block_rfft and sg14::block_irfft
+
+    /// \brief calculates the discrete Fourier transform of plan.size() real values, as rfft,
+    /// with block floating point arithmetic
+    ///
+    /// \return the exponent, e, such that the transform is the output multiplied by 2^-e
+    template<class Rep, int Exponent>
+    int block_rfft(
+            const rfft_plan<fixed_point<Rep, Exponent>>& plan, const fixed_point<Rep, Exponent>* input,
+            std::complex<fixed_point<Rep, Exponent>>* output)
+    {
+        auto const half = plan.size()/2;
+        _impl::fft::pack(input, plan.size(), output);
+        auto const scale = block_fft(plan.half(), output);
+
+        // each part of X(k) is at most twice the largest part of Z
+        auto const split_scale = _impl::fft::normalize(output, half, 1);
+        _impl::fft::split(plan, output);
+        return scale+split_scale;
+    }
+
+    /// \brief calculates half the unscaled inverse discrete Fourier transform of plan.size() values, as irfft,
+    /// with block floating point arithmetic
+    ///
+    /// \return the exponent, e, such that the plan.size() real values multiplied by plan.size()/2
+    /// are the output multiplied by 2^-e
+    template<class Rep, int Exponent>
+    int block_irfft(
+            const rfft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            fixed_point<Rep, Exponent>* output)
+    {
+        auto const half = plan.size()/2;
+        auto const merge_scale = _impl::fft::normalize(data, half, 1);
+        _impl::fft::merge(plan, data);
+        auto const scale = block_ifft(plan.half(), data);
+        _impl::fft::unpack(data, plan.size(), output);
+        return merge_scale+scale;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::batch_fft and sg14::batch_ifft
+
+    /// \brief calculates the discrete Fourier transforms of count consecutive runs of plan.size() values
+    /// with the Stockham autosort algorithm, dividing them among the threads of pool
+    ///
+    /// \param data the input, which is overwritten by the output
+    /// \param work a buffer of plan.size() values for each of the threads of pool
+    ///
+    /// \note The threads share plan, which is only read.
+    template<class T>
+    void batch_fft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work, std::size_t count,
+            fft_thread_pool& pool)
+    {
+        _impl::fft::batch_stockham(plan, data, work, count, false, pool);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transforms of count consecutive runs
+    /// of plan.size() values with the Stockham autosort algorithm, dividing them among the threads of pool
+    template<class T>
+    void batch_ifft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work, std::size_t count,
+            fft_thread_pool& pool)
+    {
+        _impl::fft::batch_stockham(plan, data, work, count, true, pool);
+    }
+
+    /// \brief calculates the discrete Fourier transforms of count consecutive runs of plan.size() values
+    /// with the Stockham autosort algorithm, dividing them among threads
+    ///
+    /// \param work a buffer of plan.size() values for each of the threads
+    /// \param threads the number of threads among which the transforms are divided
+    ///
+    /// \note The threads are started and joined by each call; where transforms are repeated,
+    /// the overload taking an \ref fft_thread_pool reuses one set of threads.
+    template<class T>
+    void batch_fft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work, std::size_t count,
+            unsigned threads = 1)
+    {
+        fft_thread_pool pool(static_cast<unsigned>(std::min<std::size_t>(threads, count)));
+        batch_fft(plan, data, work, count, pool);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transforms of count consecutive runs
+    /// of plan.size() values with the Stockham autosort algorithm, dividing them among threads
+    template<class T>
+    void batch_ifft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::complex<T>* work, std::size_t count,
+            unsigned threads = 1)
+    {
+        fft_thread_pool pool(static_cast<unsigned>(std::min<std::size_t>(threads, count)));
+        batch_ifft(plan, data, work, count, pool);
+    }
+
+    /// \brief calculates the discrete Fourier transforms of count consecutive runs of plan.size() values
+    /// in place with the Cooley-Tukey algorithm, dividing them among the threads of pool
+    ///
+    /// \tparam Algorithm one of \ref radix_2_tag, \ref radix_4_tag and \ref split_radix_tag
+    template<class T, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_fft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::size_t count, fft_thread_pool& pool,
+            Algorithm algorithm = Algorithm{})
+    {
+        _impl::fft::batch_transform(plan, data, count, false, _impl::fft::unscaled{}, algorithm, nullptr, pool);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transforms of count consecutive runs
+    /// of plan.size() values in place with the Cooley-Tukey algorithm, dividing them among the threads of pool
+    template<class T, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_ifft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::size_t count, fft_thread_pool& pool,
+            Algorithm algorithm = Algorithm{})
+    {
+        _impl::fft::batch_transform(plan, data, count, true, _impl::fft::unscaled{}, algorithm, nullptr, pool);
+    }
+
+    /// \brief calculates the discrete Fourier transforms of count consecutive runs of plan.size() values
+    /// in place with the Cooley-Tukey algorithm, dividing them among threads
+    ///
+    /// \note The threads are started and joined by each call.
+    template<class T, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_fft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::size_t count, unsigned threads = 1,
+            Algorithm algorithm = Algorithm{})
+    {
+        fft_thread_pool pool(static_cast<unsigned>(std::min<std::size_t>(threads, count)));
+        batch_fft(plan, data, count, pool, algorithm);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transforms of count consecutive runs
+    /// of plan.size() values in place with the Cooley-Tukey algorithm, dividing them among threads
+    template<class T, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_ifft(
+            const fft_plan<T>& plan, std::complex<T>* data, std::size_t count, unsigned threads = 1,
+            Algorithm algorithm = Algorithm{})
+    {
+        fft_thread_pool pool(static_cast<unsigned>(std::min<std::size_t>(threads, count)));
+        batch_ifft(plan, data, count, pool, algorithm);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::batch_block_fft and sg14::batch_block_ifft
+
+    /// \brief calculates the discrete Fourier transforms of count consecutive runs of plan.size() values
+    /// in place with block floating point arithmetic, dividing them among the threads of pool
+    ///
+    /// \param exponents count exponents, each that of the corresponding transform as returned by block_fft
+    template<class Rep, int Exponent, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_block_fft(
+            const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            std::size_t count, int* exponents, fft_thread_pool& pool, Algorithm algorithm = Algorithm{})
+    {
+        _impl::fft::batch_transform(
+                plan, data, count, false, _impl::fft::block_scaled{}, algorithm, exponents, pool);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transforms of count consecutive runs
+    /// of plan.size() values in place with block floating point arithmetic, dividing them among the threads of pool
+    ///
+    /// \param exponents count exponents, each that of the corresponding transform as returned by block_ifft
+    template<class Rep, int Exponent, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_block_ifft(
+            const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            std::size_t count, int* exponents, fft_thread_pool& pool, Algorithm algorithm = Algorithm{})
+    {
+        _impl::fft::batch_transform(
+                plan, data, count, true, _impl::fft::block_scaled{}, algorithm, exponents, pool);
+    }
+
+    /// \brief calculates the discrete Fourier transforms of count consecutive runs of plan.size() values
+    /// in place with block floating point arithmetic, dividing them among threads
+    ///
+    /// \note The threads are started and joined by each call.
+    template<class Rep, int Exponent, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_block_fft(
+            const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            std::size_t count, int* exponents, unsigned threads = 1, Algorithm algorithm = Algorithm{})
+    {
+        fft_thread_pool pool(static_cast<unsigned>(std::min<std::size_t>(threads, count)));
+        batch_block_fft(plan, data, count, exponents, pool, algorithm);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transforms of count consecutive runs
+    /// of plan.size() values in place with block floating point arithmetic, dividing them among threads
+    template<class Rep, int Exponent, class Algorithm = radix_2_tag,
+            class = _impl::enable_if_t<_impl::fft::is_algorithm<Algorithm>::value>>
+    void batch_block_ifft(
+            const fft_plan<fixed_point<Rep, Exponent>>& plan, std::complex<fixed_point<Rep, Exponent>>* data,
+            std::size_t count, int* exponents, unsigned threads = 1, Algorithm algorithm = Algorithm{})
+    {
+        fft_thread_pool pool(static_cast<unsigned>(std::min<std::size_t>(threads, count)));
+        batch_block_ifft(plan, data, count, exponents, pool, algorithm);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::parallel_fft and sg14::parallel_ifft
+
+    /// \brief calculates the discrete Fourier transform of plan.size() values in place
+    /// with the radix-2 Cooley-Tukey algorithm, dividing each stage among the threads of pool
+    ///
+    /// \note The values are divided among the largest power of two of the threads which leaves each
+    /// at least 2^16 of them, so transforms of fewer than 2^17 values are made by the calling thread.
+    /// The stages which combine values within a thread's share are made without waiting for the other threads;
+    /// the threads finish each of the remaining stages before beginning the next.
+    /// The output is that of fft with \ref radix_2_tag.
+    template<class T>
+    void parallel_fft(const fft_plan<T>& plan, std::complex<T>* data, fft_thread_pool& pool)
+    {
+        _impl::fft::parallel_transform(plan, data, false, pool);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transform of plan.size() values in place
+    /// with the radix-2 Cooley-Tukey algorithm, dividing each stage among the threads of pool
+    template<class T>
+    void parallel_ifft(const fft_plan<T>& plan, std::complex<T>* data, fft_thread_pool& pool)
+    {
+        _impl::fft::parallel_transform(plan, data, true, pool);
+    }
+
+    /// \brief calculates the discrete Fourier transform of plan.size() values in place
+    /// with the radix-2 Cooley-Tukey algorithm, dividing each stage among threads
+    ///
+    /// \note The threads are started and joined by each call; where transforms are repeated,
+    /// the overload taking an \ref fft_thread_pool reuses one set of threads.
+    template<class T>
+    void parallel_fft(const fft_plan<T>& plan, std::complex<T>* data, unsigned threads)
+    {
+        fft_thread_pool pool(_impl::fft::parallel_parts(plan.size(), threads));
+        parallel_fft(plan, data, pool);
+    }
+
+    /// \brief calculates the unscaled inverse discrete Fourier transform of plan.size() values in place
+    /// with the radix-2 Cooley-Tukey algorithm, dividing each stage among threads
+    template<class T>
+    void parallel_ifft(const fft_plan<T>& plan, std::complex<T>* data, unsigned threads)
+    {
+        fft_thread_pool pool(_impl::fft::parallel_parts(plan.size(), threads));
+        parallel_ifft(plan, data, pool);
+    }
+}
+
+#endif	// SG14_FFT_H
@@ -0,0 +1,245 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief finite impulse response filters of `sg14::fixed_point` samples
+
+#if !defined(SG14_FIR_FILTER_H)
+#define SG14_FIR_FILTER_H 1
+
+#include <sg14/auxiliary/batch.h>
+
+#include <algorithm>
+#include <cstddef>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    namespace _impl {
+        namespace fir {
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::fir::delay_line
+
+            // the number of samples pushed onto a delay line at once
+            constexpr std::size_t chunk_size = 64;
+
+            // the most recent samples, stored twice over so that the Length samples ending with any of
+            // the last chunk_size samples pushed are contiguous and can be passed to a dot product kernel;
+            // samples are pushed a chunk at a time so that they are not loaded straight after being stored
+            template<class Sample, std::size_t Length>
+            class delay_line {
+                static constexpr std::size_t capacity = Length+chunk_size-1;
+
+            public:
+                delay_line()
+                {
+                    reset();
+                }
+
+                void reset()
+                {
+                    for (auto& sample : _samples) {
+                        sample = Sample{0};
+                    }
+                    _position = 0;
+                    _pushed = 0;
+                }
+
+                // pushes up to chunk_size samples
+                void push(const Sample* first, std::size_t count)
+                {
+                    for (auto const last = first+count; first!=last; ++first) {
+                        _samples[_position] = *first;
+                        _samples[_position+capacity] = *first;
+                        if (++_position==capacity) {
+                            _position = 0;
+                        }
+                    }
+                    _pushed = count;
+                }
+
+                // the Length samples ending with the given sample of those last pushed, from the oldest to the newest
+                const Sample* window(std::size_t index) const
+                {
+                    return _samples+(_position+capacity*2+index+1-_pushed-Length)%capacity;
+                }
+
+            private:
+                Sample _samples[capacity*2];
+                std::size_t _position;
+                std::size_t _pushed;
+            };
+
+            // the dot product kernel chosen for the selected instruction set
+            template<class Coeff, class Sample, std::size_t Length>
+            using dot_key = fp::batch::dot_key<Coeff, Sample,
+                    typename fp::batch::dot_result<Coeff, Sample, Length>::type::rep>;
+
+            template<class Coeff, class Sample, std::size_t Length>
+            typename dispatch::registry<dot_key<Coeff, Sample, Length>>::function* dot_kernel()
+            {
+                return dispatch::registry<dot_key<Coeff, Sample, Length>>::selected();
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fir_filter
+
+    /// \brief a finite impulse response filter of \ref fixed_point samples
+    ///
+    /// \tparam Coeff the \ref fixed_point type of the coefficients
+    /// \tparam Sample the \ref fixed_point type of the input samples
+    /// \tparam Taps the number of coefficients
+    ///
+    /// \note Each output is the sum of the products of the coefficients and the most recent samples
+    /// calculated with \ref dot in a representation that cannot overflow.
+    /// The filter holds its state in fixed-size arrays and never allocates.
+    template<class Coeff, class Sample, std::size_t Taps>
+    class fir_filter {
+    public:
+        using coefficient_type = Coeff;
+        using sample_type = Sample;
+
+        /// the type of unconverted outputs, wide enough to hold any sum of Taps products
+        using accumulator_type = typename _impl::fp::batch::dot_result<Coeff, Sample, Taps>::type;
+
+        /// constructs a filter with the given impulse response and a delay line of zeros
+        explicit fir_filter(const coefficient_type (&coefficients)[Taps])
+        {
+            for (auto tap = std::size_t{0}; tap!=Taps; ++tap) {
+                _reversed[tap] = coefficients[Taps-1-tap];
+            }
+        }
+
+        /// sets the delay line to zero
+        void reset()
+        {
+            _history.reset();
+        }
+
+        /// filters a single sample
+        accumulator_type process(const sample_type& sample)
+        {
+            _history.push(&sample, 1);
+            return accumulator_type::from_data(
+                    _impl::fir::dot_kernel<Coeff, Sample, Taps>()(_reversed, _reversed+Taps, _history.window(0)));
+        }
+
+        /// \brief filters the block of samples, [first, last)
+        ///
+        /// \return end of the output range beginning at d_first whose values are converted from accumulator_type
+        template<class Output>
+        Output* process(const sample_type* first, const sample_type* last, Output* d_first)
+        {
+            auto const kernel = _impl::fir::dot_kernel<Coeff, Sample, Taps>();
+            while (first!=last) {
+                auto const count = std::min(static_cast<std::size_t>(last-first), _impl::fir::chunk_size);
+                _history.push(first, count);
+                for (auto index = std::size_t{0}; index!=count; ++index, ++d_first) {
+                    *d_first = static_cast<Output>(
+                            accumulator_type::from_data(kernel(_reversed, _reversed+Taps, _history.window(index))));
+                }
+                first += count;
+            }
+            return d_first;
+        }
+
+    private:
+        // the coefficients in the order of the delay line, from the oldest sample to the newest
+        coefficient_type _reversed[Taps];
+        _impl::fir::delay_line<Sample, Taps> _history;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::polyphase_fir_filter
+
+    /// \brief a finite impulse response filter which resamples by a rational factor
+    ///
+    /// \tparam Coeff the \ref fixed_point type of the coefficients
+    /// \tparam Sample the \ref fixed_point type of the input samples
+    /// \tparam Taps the number of coefficients, a multiple of Interpolation
+    /// \tparam Interpolation the factor by which the sample rate is multiplied
+    /// \tparam Decimation the factor by which the sample rate is divided
+    ///
+    /// \note The outputs are those of a \ref fir_filter applied to the input with Interpolation-1 zeros
+    /// inserted after each sample, keeping one in every Decimation outputs.
+    /// The coefficients are split into Interpolation phases of Taps/Interpolation coefficients
+    /// so that no products of the inserted zeros or of discarded outputs are calculated.
+    template<class Coeff, class Sample, std::size_t Taps, std::size_t Interpolation, std::size_t Decimation = 1>
+    class polyphase_fir_filter {
+        static_assert(Interpolation>0 && Decimation>0, "resampling factors must be positive");
+        static_assert(Taps%Interpolation==0, "Taps must be a multiple of Interpolation");
+
+        static constexpr std::size_t phase_taps = Taps/Interpolation;
+
+    public:
+        using coefficient_type = Coeff;
+        using sample_type = Sample;
+
+        /// the type of unconverted outputs, wide enough to hold any sum of Taps/Interpolation products
+        using accumulator_type = typename _impl::fp::batch::dot_result<Coeff, Sample, phase_taps>::type;
+
+        /// constructs a filter with the given impulse response and a delay line of zeros
+        explicit polyphase_fir_filter(const coefficient_type (&coefficients)[Taps])
+                :_phase(0)
+        {
+            for (auto phase = std::size_t{0}; phase!=Interpolation; ++phase) {
+                for (auto tap = std::size_t{0}; tap!=phase_taps; ++tap) {
+                    _phases[phase][phase_taps-1-tap] = coefficients[tap*Interpolation+phase];
+                }
+            }
+        }
+
+        /// sets the delay line to zero and restarts the output phase
+        void reset()
+        {
+            _history.reset();
+            _phase = 0;
+        }
+
+        /// \brief resamples the block of samples, [first, last)
+        ///
+        /// \return end of the output range beginning at d_first whose values are converted from accumulator_type;
+        /// it holds up to (Interpolation*(last-first)+Decimation-1)/Decimation values
+        template<class Output>
+        Output* process(const sample_type* first, const sample_type* last, Output* d_first)
+        {
+            auto const kernel = _impl::fir::dot_kernel<Coeff, Sample, phase_taps>();
+            while (first!=last) {
+                auto const count = std::min(static_cast<std::size_t>(last-first), _impl::fir::chunk_size);
+                _history.push(first, count);
+                for (auto index = std::size_t{0}; index!=count; ++index) {
+                    auto const window = _history.window(index);
+                    for (; _phase<Interpolation; _phase += Decimation, ++d_first) {
+                        auto const coefficients = _phases[_phase];
+                        *d_first = static_cast<Output>(accumulator_type::from_data(
+                                kernel(coefficients, coefficients+phase_taps, window)));
+                    }
+                    _phase -= Interpolation;
+                }
+                first += count;
+            }
+            return d_first;
+        }
+
+    private:
+        // the coefficients of each phase in the order of the delay line, from the oldest sample to the newest
+        coefficient_type _phases[Interpolation][phase_taps];
+        _impl::fir::delay_line<Sample, phase_taps> _history;
+
+        // the position of the next output after the most recent sample in the interpolated sample rate
+        std::size_t _phase;
+    };
+
+    /// \brief a \ref polyphase_fir_filter which reduces the sample rate by a whole factor
+    template<class Coeff, class Sample, std::size_t Taps, std::size_t Decimation>
+    using decimating_fir_filter = polyphase_fir_filter<Coeff, Sample, Taps, 1, Decimation>;
+
+    /// \brief a \ref polyphase_fir_filter which increases the sample rate by a whole factor
+    template<class Coeff, class Sample, std::size_t Taps, std::size_t Interpolation>
+    using interpolating_fir_filter = polyphase_fir_filter<Coeff, Sample, Taps, Interpolation, 1>;
+}
+
+#endif	// SG14_FIR_FILTER_H
@@ -0,0 +1,87 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief multiplication of matrices of `sg14::fixed_point` values with 8- and 16-bit reps
+
+#if !defined(SG14_GEMM_H)
+#define SG14_GEMM_H 1
+
+#include <sg14/auxiliary/batch.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::gemm_result_t
+
+    /// \brief the \ref fixed_point type of the product of matrices of Lhs and Rhs
+    ///
+    /// \note Its rep is std::int32_t and its exponent is that of the product of Lhs and Rhs.
+    template<class Lhs, class Rhs>
+    using gemm_result_t = typename _impl::fp::batch::gemm_result<Lhs, Rhs>::type;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::gemm
+
+    /// \brief calculates C = AB
+    ///
+    /// \param m the number of rows of A and C
+    /// \param n the number of columns of B and C
+    /// \param k the number of columns of A and rows of B
+    /// \param a the first element of A, whose rows begin every lda elements
+    /// \param b the first element of B, whose rows begin every ldb elements
+    /// \param c the first element of C, whose rows begin every ldc elements
+    /// \param threads the number of threads among which the rows of C are divided
+    ///
+    /// \note The reps of the operands must be signed integers of no more than 16 bits.
+    /// The elements of C are the sums of products modulo 2^32.
+    /// The operands are multiplied in blocks which fit in cache, packed in panels for a micro-kernel
+    /// chosen at run time.
+    template<class LhsRep, int LhsExponent, class RhsRep, int RhsExponent>
+    void gemm(std::size_t m, std::size_t n, std::size_t k,
+            const fixed_point<LhsRep, LhsExponent>* a, std::size_t lda,
+            const fixed_point<RhsRep, RhsExponent>* b, std::size_t ldb,
+            gemm_result_t<fixed_point<LhsRep, LhsExponent>, fixed_point<RhsRep, RhsExponent>>* c, std::size_t ldc,
+            unsigned threads = 1)
+    {
+        static_assert(std::is_integral<LhsRep>::value && std::is_signed<LhsRep>::value && sizeof(LhsRep)<=2
+                      && std::is_integral<RhsRep>::value && std::is_signed<RhsRep>::value && sizeof(RhsRep)<=2,
+                "gemm requires signed integer reps of no more than 16 bits");
+
+        using key = _impl::fp::batch::gemm_key<fixed_point<LhsRep, LhsExponent>, fixed_point<RhsRep, RhsExponent>>;
+        auto const kernel = _impl::dispatch::registry<key>::selected();
+
+        // each thread multiplies a band of the rows of A
+        auto const band = (m+std::max(threads, 1u)-1)/std::max(threads, 1u);
+        auto workers = std::vector<std::thread>{};
+#if defined(SG14_EXCEPTIONS_ENABLED)
+        try {
+#endif
+            for (auto row = band; row<m; row += band) {
+                workers.emplace_back(kernel, std::min(band, m-row), n, k, a+row*lda, lda, b, ldb, c+row*ldc, ldc);
+            }
+#if defined(SG14_EXCEPTIONS_ENABLED)
+        }
+        catch (...) {
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            throw;
+        }
+#endif
+
+        kernel(std::min(band, m), n, k, a, lda, b, ldb, c, ldc);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+}
+
+#endif	// SG14_GEMM_H
@@ -144,6 +144,35 @@ namespace sg14 {
     {
         return digits<Integer>::value-used_bits(value);
     }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::_impl::multiply_high
+
+    namespace _impl {
+        // returns the upper 64 bits of the 128-bit product of two 64-bit unsigned integers
+#if defined(SG14_INT128_ENABLED)
+        constexpr std::uint64_t multiply_high(std::uint64_t lhs, std::uint64_t rhs)
+        {
+            return static_cast<std::uint64_t>((static_cast<SG14_UINT128>(lhs)*rhs) >> 64);
+        }
+#else
+        constexpr std::uint64_t multiply_high_combine(
+                std::uint64_t low_low, std::uint64_t low_high, std::uint64_t high_low, std::uint64_t high_high)
+        {
+            return high_high+(low_high >> 32)+(high_low >> 32)
+                   +(((low_low >> 32)+(low_high & UINT32_MAX)+(high_low & UINT32_MAX)) >> 32);
+        }
+
+        constexpr std::uint64_t multiply_high(std::uint64_t lhs, std::uint64_t rhs)
+        {
+            return multiply_high_combine(
+                    (lhs & UINT32_MAX)*(rhs & UINT32_MAX),
+                    (lhs & UINT32_MAX)*(rhs >> 32),
+                    (lhs >> 32)*(rhs & UINT32_MAX),
+                    (lhs >> 32)*(rhs >> 32));
+        }
+#endif
+    }
 }
 
 #endif  // SG14_NUMERIC_H
@@ -44,4 +44,19 @@ using SG14_UINT128 = unsigned __int128;
 #define SG14_EXCEPTIONS_ENABLED
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// SG14_SIMD_ENABLED macro definition
+
+#if defined(SG14_SIMD_ENABLED)
+#error SG14_SIMD_ENABLED already defined
+#endif
+
+// GCC/Clang x86-64 builds compile vector kernels for several instruction sets
+// and choose between them at run time
+#if !defined(SG14_DISABLE_SIMD) && !defined(SG14_DISABLE_GCC_BUILTINS)
+#if (defined(__GNUG__) || defined(__clang__)) && defined(__x86_64__)
+#define SG14_SIMD_ENABLED
+#endif
+#endif
+
 #endif // SG14_CONFIG_H
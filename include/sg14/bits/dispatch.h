@@ -0,0 +1,167 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief selection at run time between kernels compiled for different instruction sets;
+/// included from sg14/auxiliary/batch.h - do not include directly!
+
+#if !defined(SG14_DISPATCH_H)
+#define SG14_DISPATCH_H 1
+
+#include "config.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::instruction_set
+
+    /// \brief the instruction sets for which vector kernels are compiled, in order of preference
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \sa selected_instruction_set
+    enum class instruction_set {
+        scalar,
+        sse4_1,
+        avx2,
+        avx512
+    };
+
+    /// \brief the name of an instruction set, as accepted by the `SG14_INSTRUCTION_SET` environment variable
+    /// \headerfile sg14/auxiliary/batch.h
+    constexpr const char* instruction_set_name(instruction_set set)
+    {
+        return (set==instruction_set::avx512)
+               ? "avx512"
+               : (set==instruction_set::avx2)
+                 ? "avx2"
+                 : (set==instruction_set::sse4_1)
+                   ? "sse4_1"
+                   : "scalar";
+    }
+
+    namespace _impl {
+        namespace dispatch {
+            constexpr int num_instruction_sets = static_cast<int>(instruction_set::avx512)+1;
+
+            // queries cpuid for the most preferred instruction set usable by the processor and operating system
+            inline instruction_set detect_instruction_set()
+            {
+#if defined(SG14_SIMD_ENABLED)
+                __builtin_cpu_init();
+                return (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")
+                        && __builtin_cpu_supports("avx512bw"))
+                       ? instruction_set::avx512
+                       : __builtin_cpu_supports("avx2")
+                         ? instruction_set::avx2
+                         : __builtin_cpu_supports("sse4.1")
+                           ? instruction_set::sse4_1
+                           : instruction_set::scalar;
+#else
+                return instruction_set::scalar;
+#endif
+            }
+
+            // the instruction set with the given name or fallback if there is no such instruction set
+            inline instruction_set parse_instruction_set(const char* name, instruction_set fallback)
+            {
+                for (auto i = 0; i!=num_instruction_sets; ++i) {
+                    auto const set = static_cast<instruction_set>(i);
+                    if (name && std::strcmp(name, instruction_set_name(set))==0) {
+                        return set;
+                    }
+                }
+                return fallback;
+            }
+
+            // the requested instruction set or the supported instruction set, whichever is less preferred
+            inline instruction_set limit_instruction_set(const char* requested, instruction_set supported)
+            {
+                return std::min(parse_instruction_set(requested, supported), supported);
+            }
+        }
+    }
+
+    /// \brief the most preferred instruction set supported by the processor
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \note Vector kernels are only compiled by GCC and Clang for x86-64
+    /// and can be disabled by defining `SG14_DISABLE_SIMD`.
+    inline instruction_set supported_instruction_set()
+    {
+        static auto const supported = _impl::dispatch::detect_instruction_set();
+        return supported;
+    }
+
+    /// \brief the instruction set used by the vector kernels in this process
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \note For testing, the `SG14_INSTRUCTION_SET` environment variable may name a less preferred
+    /// instruction set than \ref supported_instruction_set, e.g. `SG14_INSTRUCTION_SET=sse4_1`.
+    /// It is read once, before the first kernel is dispatched.
+    inline instruction_set selected_instruction_set()
+    {
+#if defined(SG14_SIMD_ENABLED)
+        static auto const selected = _impl::dispatch::limit_instruction_set(
+                std::getenv("SG14_INSTRUCTION_SET"), supported_instruction_set());
+        return selected;
+#else
+        return instruction_set::scalar;
+#endif
+    }
+
+    namespace _impl {
+        namespace dispatch {
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::dispatch::table
+
+            // function pointers indexed by instruction set;
+            // the scalar entry is required and other entries are null where no kernel is compiled
+            template<class Function>
+            struct table {
+                Function* entries[num_instruction_sets];
+
+                // the entry of the most preferred instruction set which is no more preferred than set
+                Function* select(instruction_set set) const
+                {
+                    auto index = static_cast<int>(set);
+                    while (!entries[index]) {
+                        --index;
+                    }
+                    return entries[index];
+                }
+            };
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sg14::_impl::dispatch::registry
+
+            // resolves the kernels identified by Key, which provides the member type, function,
+            // and the static member function, entries, returning a table<function>
+            template<class Key>
+            struct registry {
+                using function = typename Key::function;
+
+                // the kernel compiled for the given instruction set, which must be supported
+                static function* select(instruction_set set)
+                {
+                    return Key::entries().select(set);
+                }
+
+                // the kernel compiled for the selected instruction set, resolved once
+                static function* selected()
+                {
+                    static auto const kernel = select(selected_instruction_set());
+                    return kernel;
+                }
+            };
+        }
+    }
+}
+
+#endif	// SG14_DISPATCH_H
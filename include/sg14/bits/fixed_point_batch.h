@@ -0,0 +1,1282 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief math, arithmetic and conversion functions of the `sg14::fixed_point` type applied to contiguous ranges of values
+/// with vector instructions chosen at run time;
+/// included from sg14/auxiliary/batch.h - do not include directly!
+
+#if !defined(SG14_FIXED_POINT_BATCH_H)
+#define SG14_FIXED_POINT_BATCH_H 1
+
+#include <sg14/fixed_point>
+#include "dispatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <memory>
+
+#if defined(SG14_SIMD_ENABLED)
+#include <immintrin.h>
+#endif
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    template<class Rep, class OverflowTag>
+    class safe_integer;
+
+    // the tags of sg14/auxiliary/overflow.h and sg14/auxiliary/precise_integer.h
+    // which select the behavior of the batch conversion functions
+    struct native_overflow_tag;
+    struct saturated_overflow_tag;
+    struct closest_rounding_tag;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // kernels of the batch math functions
+    //
+    // Each kernel applies a scalar function to a single value and is defined for every input:
+    // where the scalar function would throw or overflow, the kernel saturates instead.
+
+    namespace _impl {
+        namespace fp {
+            namespace batch {
+                struct abs_kernel {
+                    template<class Rep, int Exponent>
+                    static constexpr fixed_point<Rep, Exponent> apply(fixed_point<Rep, Exponent> x)
+                    {
+                        return fixed_point<Rep, Exponent>::from_data(
+                                working::saturate<Rep>(working::rep_traits<Rep>::magnitude(x.data())));
+                    }
+                };
+
+                // negative input yields zero
+                struct sqrt_kernel {
+                    template<class Rep, int Exponent>
+                    static constexpr fixed_point<Rep, Exponent> apply(fixed_point<Rep, Exponent> x)
+                    {
+                        return working::rep_traits<Rep>::negative(x.data())
+                               ? fixed_point<Rep, Exponent>::from_data(Rep{0})
+                               : sg14::sqrt(x);
+                    }
+                };
+
+                template<class Rep, int Exponent>
+                constexpr bool exp2_overflows(Rep rep)
+                {
+                    return (Exponent<0) && (Exponent>-64)
+                           && (static_cast<working::working_rep>(rep) >> ((Exponent<0) ? -Exponent : 0))
+                              >=digits<Rep>::value+Exponent;
+                }
+
+                struct exp2_kernel {
+                    template<class Rep, int Exponent>
+                    static constexpr fixed_point<Rep, Exponent> apply(fixed_point<Rep, Exponent> x)
+                    {
+                        return exp2_overflows<Rep, Exponent>(x.data())
+                               ? fixed_point<Rep, Exponent>::from_data(static_cast<Rep>(working::rep_max<Rep>()))
+                               : sg14::exp2(x);
+                    }
+                };
+
+                // non-positive input yields the lowest value
+                struct log2_kernel {
+                    template<class Rep, int Exponent>
+                    static constexpr fixed_point<Rep, Exponent> apply(fixed_point<Rep, Exponent> x)
+                    {
+                        return fixed_point<Rep, Exponent>::from_data(log_rep(x.data(), -Exponent, 0));
+                    }
+                };
+
+                struct sin_kernel {
+                    template<class Rep, int Exponent>
+                    static constexpr fixed_point<Rep, Exponent> apply(fixed_point<Rep, Exponent> x)
+                    {
+                        return sg14::sin(x);
+                    }
+                };
+
+                struct cos_kernel {
+                    template<class Rep, int Exponent>
+                    static constexpr fixed_point<Rep, Exponent> apply(fixed_point<Rep, Exponent> x)
+                    {
+                        return sg14::cos(x);
+                    }
+                };
+
+                // the vector kernels hold values of up to 32 bits with up to 32 fractional digits
+                template<class Rep, int Exponent>
+                struct vectorizable : std::integral_constant<bool,
+                        std::is_integral<Rep>::value && (digits<Rep>::value<=32)
+                        && (Exponent<0) && (-Exponent<=digits<Rep>::value+(is_signed<Rep>::value ? 1 : 0))> {
+                };
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // conversion from floating-point
+
+                // x rounded toward zero
+                template<class Float>
+                Float integral(Float x, std::false_type)
+                {
+                    return std::trunc(x);
+                }
+
+                // x rounded to the nearest integer with halves rounded away from zero
+                template<class Float>
+                Float integral(Float x, std::true_type)
+                {
+                    return std::trunc(x)
+                           +((x-std::trunc(x)>=Float(.5)) ? Float(1) : (x-std::trunc(x)<=Float(-.5)) ? Float(-1) : Float(0));
+                }
+
+                // the integral value, y, as Rep; the result is unspecified if y is out of range
+                template<class Rep, class Float>
+                Rep integral_to_rep(Float y, std::false_type)
+                {
+                    return static_cast<Rep>(y);
+                }
+
+                // the integral value, y, as Rep, confined to the range of Rep and with NaN converted to zero
+                template<class Rep, class Float>
+                Rep integral_to_rep(Float y, std::true_type)
+                {
+                    return (y!=y)
+                           ? Rep{0}
+                           : (y>=type::pow2<Float, digits<Rep>::value>())
+                             ? std::numeric_limits<Rep>::max()
+                             : (y<(is_signed<Rep>::value ? -type::pow2<Float, digits<Rep>::value>() : Float(0)))
+                               ? std::numeric_limits<Rep>::lowest()
+                               : static_cast<Rep>(y);
+                }
+
+                template<class Rep, int Exponent, bool Saturate, bool Round, class Float>
+                fixed_point<Rep, Exponent> to_fixed(Float s)
+                {
+                    return fixed_point<Rep, Exponent>::from_data(integral_to_rep<Rep>(
+                            integral(s*type::pow2<Float, -Exponent>(), std::integral_constant<bool, Round>{}),
+                            std::integral_constant<bool, Saturate>{}));
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // arithmetic
+
+                // the result of Operator, converted to the type of its operands
+                template<class Operator, class Rep, int Exponent>
+                fixed_point<Rep, Exponent> operate(fixed_point<Rep, Exponent> lhs, fixed_point<Rep, Exponent> rhs)
+                {
+                    return fixed_point<Rep, Exponent>(Operator{}(lhs, rhs));
+                }
+
+                // the operator of the batch form of sg14::q_mul_round
+                struct q_mul_round_op {
+                    template<class Rep, int Exponent>
+                    constexpr fixed_point<Rep, Exponent> operator()(
+                            const fixed_point<Rep, Exponent>& lhs, const fixed_point<Rep, Exponent>& rhs) const
+                    {
+                        return q_mul_round(lhs, rhs);
+                    }
+                };
+
+                // the vector kernels apply saturating instructions to 8- and 16-bit saturated safe_integer
+                // and multiply signed values whose product is shifted right
+                template<class Operator, class Rep, int Exponent>
+                struct saturating_vectorizable : std::false_type {
+                };
+
+                template<class Operator, class Rep, int Exponent>
+                struct saturating_vectorizable<Operator, safe_integer<Rep, saturated_overflow_tag>, Exponent>
+                        : std::integral_constant<bool,
+                                std::is_integral<Rep>::value && (digits<Rep>::value<=16)
+                                && (sizeof(fixed_point<safe_integer<Rep, saturated_overflow_tag>, Exponent>)==sizeof(Rep))
+                                && (!std::is_same<Operator, _impl::multiply_op>::value
+                                    || (is_signed<Rep>::value && Exponent<=0 && Exponent>=-2*digits<Rep>::value))> {
+                };
+
+                // Q15 and Q31 rounding multiplication
+                template<>
+                struct saturating_vectorizable<q_mul_round_op, std::int16_t, -15> : std::true_type {
+                };
+
+                template<>
+                struct saturating_vectorizable<q_mul_round_op, std::int32_t, -31> : std::true_type {
+                };
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // dot product
+
+                // the number of bits needed to count from zero to n-1
+                constexpr int ceil_log2(unsigned long long n)
+                {
+                    return (n<=1) ? 0 : 1+ceil_log2((n+1)/2);
+                }
+
+                // the type of the sum of up to MaxLength products of Lhs and Rhs; its digits are those
+                // of the wide product, one more if the product of two lowest values can exceed them
+                // and one more for each doubling of the number of products
+                template<class Lhs, class Rhs, unsigned long long MaxLength>
+                struct dot_result {
+                    using product = arithmetic::result<arithmetic::wide_tag, _impl::multiply_op, Lhs, Rhs>;
+
+                    static constexpr int digits = product::digits
+                                                  +(std::numeric_limits<typename Lhs::rep>::is_signed
+                                                    && std::numeric_limits<typename Rhs::rep>::is_signed)
+                                                  +ceil_log2(MaxLength);
+
+                    using rep_type = set_digits_t<typename product::prewidened_result_rep, digits>;
+                    using type = fixed_point<rep_type, product::rep_exponent>;
+                };
+
+                // the vector kernels multiply pairs of 16-bit values with pmaddwd and accumulate in 64 bits
+                template<class Lhs, class Rhs, class Accumulator>
+                struct dot_vectorizable : std::integral_constant<bool,
+                        std::is_same<typename Lhs::rep, std::int16_t>::value
+                        && std::is_same<typename Rhs::rep, std::int16_t>::value
+                        && std::is_integral<Accumulator>::value && (digits<Accumulator>::value<=63)> {
+                };
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // biquad filter sections
+
+                // the vector kernels filter 16-bit samples of several channels at once in 64-bit lanes
+                template<class Coeff, class Sample, class State>
+                struct biquad_vectorizable : std::integral_constant<bool,
+                        std::is_same<typename Coeff::rep, std::int16_t>::value
+                        && std::is_same<typename Sample::rep, std::int16_t>::value
+                        && std::is_same<State, std::int64_t>::value> {
+                };
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // matrix multiplication
+                //
+                // Blocks of the operands are packed into panels of 32-bit elements, each holding the 16-bit values
+                // of two consecutive rows of B or columns of A, so that a micro-kernel can multiply them with pmaddwd.
+                // Narrower values are sign-extended as they are packed and odd depths are padded with zero.
+                // The sums are calculated modulo 2^32, so that the vector kernels need not avoid wrapping.
+
+                // the type of the product of matrices of Lhs and Rhs
+                template<class Lhs, class Rhs>
+                struct gemm_result {
+                    using type = fixed_point<std::int32_t,
+                            arithmetic::rep_op_exponent<_impl::multiply_op, Lhs, Rhs>::value>;
+                };
+
+                // the number of pairs of rows of B held in a panel, which fits in L1 cache;
+                // and the number of rows of A and columns of B in the blocks held in L2 and L3 cache
+                constexpr std::size_t gemm_depth = 128;
+                constexpr std::size_t gemm_rows = 192;
+                constexpr std::size_t gemm_columns = 2048;
+
+                inline std::int32_t pack_pair(std::int32_t low, std::int32_t high)
+                {
+                    return static_cast<std::int32_t>(static_cast<std::uint16_t>(low)
+                                                     | (std::uint32_t{static_cast<std::uint16_t>(high)} << 16));
+                }
+
+                inline std::int32_t sum_modulo(std::int32_t lhs, std::int32_t rhs)
+                {
+                    return static_cast<std::int32_t>(static_cast<std::uint32_t>(lhs)+static_cast<std::uint32_t>(rhs));
+                }
+
+                // the value, or zero outside the matrix
+                template<class T>
+                std::int32_t element(
+                        const T* first, std::size_t stride, std::size_t row, std::size_t column,
+                        std::size_t rows, std::size_t columns)
+                {
+                    return (row<rows && column<columns) ? std::int32_t{first[row*stride+column].data()} : 0;
+                }
+
+                // rows [row, row+rows) of A at depths [2*pair, 2*(pair+pairs)) in panels of Rows rows
+                template<int Rows, class Lhs>
+                void pack_lhs(
+                        const Lhs* a, std::size_t lda, std::size_t m, std::size_t k,
+                        std::size_t row, std::size_t rows, std::size_t pair, std::size_t pairs, std::int32_t* d_first)
+                {
+                    for (auto panel = std::size_t{0}; panel<rows; panel += Rows) {
+                        for (auto p = pair; p!=pair+pairs; ++p) {
+                            for (auto r = row+panel; r!=row+panel+Rows; ++r) {
+                                *d_first++ = pack_pair(element(a, lda, r, 2*p, m, k), element(a, lda, r, 2*p+1, m, k));
+                            }
+                        }
+                    }
+                }
+
+                // columns [column, column+columns) of B at depths [2*pair, 2*(pair+pairs)) in panels of Columns columns
+                template<int Columns, class Rhs>
+                void pack_rhs(
+                        const Rhs* b, std::size_t ldb, std::size_t k, std::size_t n,
+                        std::size_t column, std::size_t columns, std::size_t pair, std::size_t pairs,
+                        std::int32_t* d_first)
+                {
+                    for (auto panel = std::size_t{0}; panel<columns; panel += Columns) {
+                        for (auto p = pair; p!=pair+pairs; ++p) {
+                            for (auto c = column+panel; c!=column+panel+Columns; ++c) {
+                                *d_first++ = pack_pair(element(b, ldb, 2*p, c, k, n), element(b, ldb, 2*p+1, c, k, n));
+                            }
+                        }
+                    }
+                }
+
+                constexpr std::size_t round_up(std::size_t n, std::size_t multiple)
+                {
+                    return (n+multiple-1)/multiple*multiple;
+                }
+
+                // C = AB, where A is m by k, B is k by n and the rows of each begin every lda, ldb and ldc elements;
+                // MicroKernel::apply multiplies a panel of MicroKernel::rows rows of A
+                // and a panel of MicroKernel::columns columns of B into a tile of sums
+                template<class MicroKernel, class Lhs, class Rhs, class Result>
+                void multiply_matrices(
+                        std::size_t m, std::size_t n, std::size_t k, const Lhs* a, std::size_t lda,
+                        const Rhs* b, std::size_t ldb, Result* c, std::size_t ldc)
+                {
+                    constexpr auto mr = std::size_t{MicroKernel::rows};
+                    constexpr auto nr = std::size_t{MicroKernel::columns};
+                    auto const depth = (k+1)/2;
+                    if (!depth) {
+                        for (auto row = std::size_t{0}; row!=m; ++row) {
+                            std::fill(c+row*ldc, c+row*ldc+n, Result::from_data(0));
+                        }
+                        return;
+                    }
+
+                    auto const packed_a = std::unique_ptr<std::int32_t[]>(
+                            new std::int32_t[round_up(std::min(m, gemm_rows), mr)*std::min(depth, gemm_depth)]);
+                    auto const packed_b = std::unique_ptr<std::int32_t[]>(
+                            new std::int32_t[round_up(std::min(n, gemm_columns), nr)*std::min(depth, gemm_depth)]);
+                    std::int32_t tile[mr*nr];
+
+                    for (auto jc = std::size_t{0}; jc<n; jc += gemm_columns) {
+                        auto const nc = std::min(gemm_columns, n-jc);
+                        for (auto pc = std::size_t{0}; pc<depth; pc += gemm_depth) {
+                            auto const kc = std::min(gemm_depth, depth-pc);
+                            pack_rhs<nr>(b, ldb, k, n, jc, nc, pc, kc, packed_b.get());
+                            for (auto ic = std::size_t{0}; ic<m; ic += gemm_rows) {
+                                auto const mc = std::min(gemm_rows, m-ic);
+                                pack_lhs<mr>(a, lda, m, k, ic, mc, pc, kc, packed_a.get());
+                                for (auto jr = std::size_t{0}; jr<nc; jr += nr) {
+                                    for (auto ir = std::size_t{0}; ir<mc; ir += mr) {
+                                        MicroKernel::apply(kc, packed_a.get()+ir*kc, packed_b.get()+jr*kc, tile);
+                                        for (auto r = std::size_t{0}; r!=std::min(mr, mc-ir); ++r) {
+                                            auto const d_row = c+(ic+ir+r)*ldc+jc+jr;
+                                            for (auto col = std::size_t{0}; col!=std::min(nr, nc-jr); ++col) {
+                                                d_row[col] = Result::from_data(
+                                                        pc ? sum_modulo(d_row[col].data(), tile[r*nr+col])
+                                                           : tile[r*nr+col]);
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // multiplies panels one element at a time
+                template<int Rows, int Columns>
+                struct scalar_gemm_micro_kernel {
+                    static constexpr int rows = Rows;
+                    static constexpr int columns = Columns;
+
+                    static void apply(std::size_t pairs, const std::int32_t* a, const std::int32_t* b, std::int32_t* tile)
+                    {
+                        std::uint32_t sums[Rows*Columns] = {};
+                        for (auto p = std::size_t{0}; p!=pairs; ++p, a += Rows, b += Columns) {
+                            for (auto r = 0; r!=Rows; ++r) {
+                                for (auto col = 0; col!=Columns; ++col) {
+                                    sums[r*Columns+col] += static_cast<std::uint32_t>(
+                                            std::int32_t{static_cast<std::int16_t>(a[r])}
+                                            *static_cast<std::int16_t>(b[col]))
+                                            +static_cast<std::uint32_t>(
+                                            std::int32_t{static_cast<std::int16_t>(a[r] >> 16)}
+                                            *static_cast<std::int16_t>(b[col] >> 16));
+                                }
+                            }
+                        }
+                        for (auto i = 0; i!=Rows*Columns; ++i) {
+                            tile[i] = static_cast<std::int32_t>(sums[i]);
+                        }
+                    }
+                };
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // radix-2 FFT butterflies
+                //
+                // The vector kernels hold a complex value of 16-bit parts in each 32-bit lane, multiplying it
+                // by a twiddle factor with two pmaddwd, or a complex value of 32-bit parts in each 64-bit lane.
+                // The real and imaginary parts of each product are calculated in separate registers.
+
+                // the vector kernels transform complex values of 16- or 32-bit parts
+                template<class Rep, int Exponent>
+                struct fft_vectorizable : std::integral_constant<bool,
+                        (std::is_same<Rep, std::int16_t>::value || std::is_same<Rep, std::int32_t>::value)
+                        && (Exponent<=0) && (-Exponent<=digits<Rep>::value+1)> {
+                };
+
+                // the product of a twiddle factor and a value,
+                // each part calculated at full width before it is summed and converted
+                template<class Rep, int Exponent>
+                std::complex<fixed_point<Rep, Exponent>> complex_product(
+                        const std::complex<fixed_point<Rep, Exponent>>& w, const std::complex<fixed_point<Rep, Exponent>>& x)
+                {
+                    using part = fixed_point<Rep, Exponent>;
+                    return std::complex<part>(
+                            static_cast<part>(sg14::multiply(w.real(), x.real())-sg14::multiply(w.imag(), x.imag())),
+                            static_cast<part>(sg14::multiply(w.imag(), x.real())+sg14::multiply(w.real(), x.imag())));
+                }
+
+                template<class T>
+                std::complex<T> complex_sum(const std::complex<T>& lhs, const std::complex<T>& rhs)
+                {
+                    return std::complex<T>(static_cast<T>(lhs.real()+rhs.real()), static_cast<T>(lhs.imag()+rhs.imag()));
+                }
+
+                template<class T>
+                std::complex<T> complex_difference(const std::complex<T>& lhs, const std::complex<T>& rhs)
+                {
+                    return std::complex<T>(static_cast<T>(lhs.real()-rhs.real()), static_cast<T>(lhs.imag()-rhs.imag()));
+                }
+
+                // the complex conjugate; where the imaginary part is the lowest value, as that of
+                // e^(-2 pi i / 4) in Q15 and Q31, its negation saturates rather than wrapping
+                template<class T>
+                std::complex<T> conjugate(const std::complex<T>& z)
+                {
+                    return std::complex<T>(z.real(), (z.imag()==std::numeric_limits<T>::lowest())
+                                                     ? std::numeric_limits<T>::max()
+                                                     : static_cast<T>(-z.imag()));
+                }
+
+                // the twiddle factor, e^(-2 pi i k / n), or its conjugate
+                template<class T>
+                std::complex<T> twiddle_factor(const std::complex<T>* twiddles, std::size_t k, bool inverse)
+                {
+                    return inverse ? conjugate(twiddles[k]) : twiddles[k];
+                }
+
+                // the butterflies [first, last) of a stage of the in-place FFT with l_s butterflies per row;
+                // where last-first is a power of two and first is a multiple of it, they are whole rows
+                // or part of one row
+                struct butterfly_block {
+                    std::size_t row_first, row_last, column_first, column_last;
+                };
+
+                inline butterfly_block butterflies(std::size_t first, std::size_t last, std::size_t l_s)
+                {
+                    return (last-first<l_s)
+                           ? butterfly_block{first/l_s, first/l_s+1, first%l_s, first%l_s+(last-first)}
+                           : butterfly_block{first/l_s, last/l_s, 0, l_s};
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // identifiers of the kernels in each dispatch table
+
+                template<class Kernel, class Rep, int Exponent>
+                struct transform_key;
+
+                template<class Float, class Rep, int Exponent, bool Saturate, bool Round>
+                struct to_fixed_key;
+
+                template<class Rep, int Exponent, class Float>
+                struct to_float_key;
+
+                template<class Operator, class Rep, int Exponent>
+                struct arithmetic_key;
+
+                template<class Lhs, class Rhs, class Accumulator>
+                struct dot_key;
+
+                template<class Coeff, class Sample, class State, std::size_t Sections, int FeedbackOrder>
+                struct biquad_key;
+
+                template<class Lhs, class Rhs>
+                struct gemm_key;
+
+                template<class Rep, int Exponent>
+                struct stockham_key;
+
+                template<class Rep, int Exponent>
+                struct cooley_tukey_key;
+            }
+        }
+    }
+}
+
+#if defined(SG14_SIMD_ENABLED)
+#define SG14_LANES_BYTES 16
+#include "fixed_point_lanes.h"
+#define SG14_LANES_BYTES 32
+#include "fixed_point_lanes.h"
+#define SG14_LANES_BYTES 64
+#include "fixed_point_lanes.h"
+#endif
+
+namespace sg14 {
+    namespace _impl {
+        namespace fp {
+            namespace batch {
+                // the least preferred instruction set with which Kernel is faster than the scalar kernel
+                template<class Kernel>
+                struct minimum_instruction_set : std::integral_constant<instruction_set, instruction_set::sse4_1> {
+                };
+
+                // exp2 needs few enough operations that emulating 64-bit multiplication with SSE4.1 loses
+                template<>
+                struct minimum_instruction_set<exp2_kernel>
+                        : std::integral_constant<instruction_set, instruction_set::avx2> {
+                };
+
+                // the vector kernel identified by Key compiled for Set or null if Key does not use Set
+                template<instruction_set Set, class Key, bool Uses = Key::template uses<Set>()>
+                struct vector_entry {
+                    static constexpr typename Key::function* value()
+                    {
+                        return nullptr;
+                    }
+                };
+
+#if defined(SG14_SIMD_ENABLED)
+                template<class Key>
+                struct vector_entry<instruction_set::sse4_1, Key, true> {
+                    static constexpr typename Key::function* value()
+                    {
+                        return sse4_1::entry(Key{});
+                    }
+                };
+
+                template<class Key>
+                struct vector_entry<instruction_set::avx2, Key, true> {
+                    static constexpr typename Key::function* value()
+                    {
+                        return avx2::entry(Key{});
+                    }
+                };
+
+                template<class Key>
+                struct vector_entry<instruction_set::avx512, Key, true> {
+                    static constexpr typename Key::function* value()
+                    {
+                        return avx512::entry(Key{});
+                    }
+                };
+#endif
+
+                // the dispatch table of the scalar kernel and vector kernels identified by Key
+                template<class Key>
+                constexpr dispatch::table<typename Key::function> make_table()
+                {
+                    return dispatch::table<typename Key::function>{{
+                            &Key::scalar,
+                            vector_entry<instruction_set::sse4_1, Key>::value(),
+                            vector_entry<instruction_set::avx2, Key>::value(),
+                            vector_entry<instruction_set::avx512, Key>::value()}};
+                }
+
+                // identifies the kernels which apply Kernel to a range of fixed_point<Rep, Exponent>
+                template<class Kernel, class Rep, int Exponent>
+                struct transform_key {
+                    using function = fixed_point<Rep, Exponent>*(
+                            const fixed_point<Rep, Exponent>*, const fixed_point<Rep, Exponent>*,
+                            fixed_point<Rep, Exponent>*);
+
+                    static fixed_point<Rep, Exponent>* scalar(
+                            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            fixed_point<Rep, Exponent>* d_first)
+                    {
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = Kernel::apply(*first);
+                        }
+                        return d_first;
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return vectorizable<Rep, Exponent>::value && Set>=minimum_instruction_set<Kernel>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<transform_key>();
+                    }
+                };
+
+                // the vector kernels convert single or double precision to or from values of up to 32 bits
+                template<class Float, class Rep>
+                struct convertible : std::integral_constant<bool,
+                        (std::is_same<Float, float>::value || std::is_same<Float, double>::value)
+                        && std::is_integral<Rep>::value && (digits<Rep>::value<=32)> {
+                };
+
+                // identifies the kernels which convert a range of Float to fixed_point<Rep, Exponent>
+                template<class Float, class Rep, int Exponent, bool Saturate, bool Round>
+                struct to_fixed_key {
+                    using function = fixed_point<Rep, Exponent>*(const Float*, const Float*, fixed_point<Rep, Exponent>*);
+
+                    static fixed_point<Rep, Exponent>* scalar(
+                            const Float* first, const Float* last, fixed_point<Rep, Exponent>* d_first)
+                    {
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = to_fixed<Rep, Exponent, Saturate, Round>(*first);
+                        }
+                        return d_first;
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return convertible<Float, Rep>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<to_fixed_key>();
+                    }
+                };
+
+                // identifies the kernels which convert a range of fixed_point<Rep, Exponent> to Float
+                template<class Rep, int Exponent, class Float>
+                struct to_float_key {
+                    using function = Float*(const fixed_point<Rep, Exponent>*, const fixed_point<Rep, Exponent>*, Float*);
+
+                    static Float* scalar(
+                            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            Float* d_first)
+                    {
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = static_cast<Float>(*first);
+                        }
+                        return d_first;
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return convertible<Float, Rep>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<to_float_key>();
+                    }
+                };
+
+                // applies Kernel to [first, last) using the given instruction set, which must be supported
+                template<class Kernel, class Rep, int Exponent>
+                fixed_point<Rep, Exponent>* transform(
+                        instruction_set set, const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                        fixed_point<Rep, Exponent>* d_first)
+                {
+                    return dispatch::registry<transform_key<Kernel, Rep, Exponent>>::select(set)(first, last, d_first);
+                }
+
+                // applies Kernel to [first, last) using the selected instruction set
+                template<class Kernel, class Rep, int Exponent>
+                fixed_point<Rep, Exponent>* transform(
+                        const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                        fixed_point<Rep, Exponent>* d_first)
+                {
+                    return dispatch::registry<transform_key<Kernel, Rep, Exponent>>::selected()(first, last, d_first);
+                }
+
+                // identifies the kernels which apply Operator to corresponding values of two ranges
+                template<class Operator, class Rep, int Exponent>
+                struct arithmetic_key {
+                    using function = fixed_point<Rep, Exponent>*(
+                            const fixed_point<Rep, Exponent>*, const fixed_point<Rep, Exponent>*,
+                            const fixed_point<Rep, Exponent>*, fixed_point<Rep, Exponent>*);
+
+                    static fixed_point<Rep, Exponent>* scalar(
+                            const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+                            const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+                    {
+                        for (; first1!=last1; ++first1, ++first2, ++d_first) {
+                            *d_first = operate<Operator>(*first1, *first2);
+                        }
+                        return d_first;
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return saturating_vectorizable<Operator, Rep, Exponent>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<arithmetic_key>();
+                    }
+                };
+
+                // applies Operator to corresponding values of two ranges using the given instruction set,
+                // which must be supported
+                template<class Operator, class Rep, int Exponent>
+                fixed_point<Rep, Exponent>* transform(
+                        instruction_set set, const fixed_point<Rep, Exponent>* first1,
+                        const fixed_point<Rep, Exponent>* last1, const fixed_point<Rep, Exponent>* first2,
+                        fixed_point<Rep, Exponent>* d_first)
+                {
+                    return dispatch::registry<arithmetic_key<Operator, Rep, Exponent>>::select(set)(
+                            first1, last1, first2, d_first);
+                }
+
+                template<class Operator, class Rep, int Exponent>
+                fixed_point<Rep, Exponent>* transform(
+                        const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+                        const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+                {
+                    return dispatch::registry<arithmetic_key<Operator, Rep, Exponent>>::selected()(
+                            first1, last1, first2, d_first);
+                }
+
+                // identifies the kernels which sum the products of corresponding values of two ranges
+                template<class Lhs, class Rhs, class Accumulator>
+                struct dot_key {
+                    using function = Accumulator(const Lhs*, const Lhs*, const Rhs*);
+
+                    static Accumulator scalar(const Lhs* first1, const Lhs* last1, const Rhs* first2)
+                    {
+                        auto sum = Accumulator{0};
+                        for (; first1!=last1; ++first1, ++first2) {
+                            sum = static_cast<Accumulator>(
+                                    sum+static_cast<Accumulator>(first1->data())*static_cast<Accumulator>(first2->data()));
+                        }
+                        return sum;
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return dot_vectorizable<Lhs, Rhs, Accumulator>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<dot_key>();
+                    }
+                };
+
+                // the sum of the products of corresponding values of two ranges using the given instruction set,
+                // which must be supported
+                template<unsigned long long MaxLength, class Lhs, class Rhs>
+                typename dot_result<Lhs, Rhs, MaxLength>::type
+                dot(instruction_set set, const Lhs* first1, const Lhs* last1, const Rhs* first2)
+                {
+                    using result_type = typename dot_result<Lhs, Rhs, MaxLength>::type;
+                    return result_type::from_data(
+                            dispatch::registry<dot_key<Lhs, Rhs, typename result_type::rep>>::select(set)(
+                                    first1, last1, first2));
+                }
+
+                template<unsigned long long MaxLength, class Lhs, class Rhs>
+                typename dot_result<Lhs, Rhs, MaxLength>::type
+                dot(const Lhs* first1, const Lhs* last1, const Rhs* first2)
+                {
+                    using result_type = typename dot_result<Lhs, Rhs, MaxLength>::type;
+                    return result_type::from_data(
+                            dispatch::registry<dot_key<Lhs, Rhs, typename result_type::rep>>::selected()(
+                                    first1, last1, first2));
+                }
+
+                // identifies the kernels which apply a cascade of Sections second-order sections in transposed
+                // direct form II to the interleaved frames of any number of channels;
+                // each section holds its coefficients, b0, b1, b2, a1 and a2, in consecutive elements
+                // and its state, s1, s2 and the rounding errors of the last FeedbackOrder outputs,
+                // in consecutive rows of one value per channel
+                template<class Coeff, class Sample, class State, std::size_t Sections, int FeedbackOrder>
+                struct biquad_key {
+                    using function = void(
+                            const Coeff*, State*, std::size_t, const Sample*, const Sample*, Sample*);
+
+                    static constexpr int coefficient_count = 5;
+                    static constexpr int state_count = 2+FeedbackOrder;
+
+                    // the shift from the exponent of the products to the exponent of the samples
+                    static constexpr int shift = -Coeff::exponent;
+                    static_assert(shift>=0 && shift<63, "coefficients must have no more than 62 fractional digits");
+
+                    // filters channels [channel_first, channel_last) of the frames in [first, last)
+                    static void filter(
+                            const Coeff* coefficients, State* state, std::size_t channels,
+                            std::size_t channel_first, std::size_t channel_last,
+                            const Sample* first, const Sample* last, Sample* d_first)
+                    {
+                        using sample_rep = typename Sample::rep;
+                        auto const frames = static_cast<std::size_t>(last-first)/channels;
+                        auto const mask = (State{1} << shift)-1;
+                        for (auto channel = channel_first; channel!=channel_last; ++channel) {
+                            for (auto frame = std::size_t{0}; frame!=frames; ++frame) {
+                                auto x = static_cast<State>(first[frame*channels+channel].data());
+                                for (auto section = std::size_t{0}; section!=Sections; ++section) {
+                                    auto const c = coefficients+section*coefficient_count;
+                                    auto const s = state+section*state_count*channels+channel;
+                                    auto const feedback = (FeedbackOrder==0)
+                                                          ? State{0}
+                                                          : (FeedbackOrder==1)
+                                                            ? s[2*channels]
+                                                            : static_cast<State>(2*s[2*channels]-s[3*channels]);
+                                    auto const accumulator = static_cast<State>(c[0].data()*x+s[0]+feedback);
+                                    auto const y = static_cast<State>(
+                                            working::saturate<sample_rep>(accumulator >> shift));
+                                    if (FeedbackOrder==2) {
+                                        s[3*channels] = s[2*channels];
+                                    }
+                                    if (FeedbackOrder>=1) {
+                                        s[2*channels] = accumulator & mask;
+                                    }
+                                    s[0] = static_cast<State>(c[1].data()*x-c[3].data()*y+s[channels]);
+                                    s[channels] = static_cast<State>(c[2].data()*x-c[4].data()*y);
+                                    x = y;
+                                }
+                                d_first[frame*channels+channel] = Sample::from_data(static_cast<sample_rep>(x));
+                            }
+                        }
+                    }
+
+                    static void scalar(
+                            const Coeff* coefficients, State* state, std::size_t channels,
+                            const Sample* first, const Sample* last, Sample* d_first)
+                    {
+                        filter(coefficients, state, channels, 0, channels, first, last, d_first);
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return biquad_vectorizable<Coeff, Sample, State>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<biquad_key>();
+                    }
+                };
+
+                // identifies the kernels which multiply matrices of Lhs and Rhs
+                template<class Lhs, class Rhs>
+                struct gemm_key {
+                    using result_type = typename gemm_result<Lhs, Rhs>::type;
+                    using function = void(
+                            std::size_t, std::size_t, std::size_t, const Lhs*, std::size_t, const Rhs*, std::size_t,
+                            result_type*, std::size_t);
+
+                    static void scalar(
+                            std::size_t m, std::size_t n, std::size_t k, const Lhs* a, std::size_t lda,
+                            const Rhs* b, std::size_t ldb, result_type* c, std::size_t ldc)
+                    {
+                        multiply_matrices<scalar_gemm_micro_kernel<4, 4>>(m, n, k, a, lda, b, ldb, c, ldc);
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return true;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<gemm_key>();
+                    }
+                };
+
+                // identifies the kernels which apply pass q of the Stockham autosort FFT of n values
+                // to y, writing x, with the n/2 twiddle factors, e^(-2 pi i k / n), or their conjugates
+                template<class Rep, int Exponent>
+                struct stockham_key {
+                    using value_type = std::complex<fixed_point<Rep, Exponent>>;
+                    using function = void(const value_type*, std::size_t, int, bool, const value_type*, value_type*);
+
+                    static void scalar(
+                            const value_type* twiddles, std::size_t n, int q, bool inverse,
+                            const value_type* y, value_type* x)
+                    {
+                        auto const l_s = std::size_t{1} << (q-1);
+                        auto const r = n >> q;
+                        auto const r_s = n >> (q-1);
+                        for (auto j = std::size_t{0}; j!=l_s; ++j) {
+                            auto const w = twiddle_factor(twiddles, j*r, inverse);
+                            for (auto k = std::size_t{0}; k!=r; ++k) {
+                                auto const tau = complex_product(w, y[j*r_s+k+r]);
+                                x[j*r+k] = complex_sum(y[j*r_s+k], tau);
+                                x[(j+l_s)*r+k] = complex_difference(y[j*r_s+k], tau);
+                            }
+                        }
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return fft_vectorizable<Rep, Exponent>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<stockham_key>();
+                    }
+                };
+
+                // identifies the kernels which apply butterflies [first, last) of the n/2 of stage q
+                // of the in-place Cooley-Tukey FFT of n values in bit-reversed order with the n/2 twiddle factors,
+                // e^(-2 pi i k / n), or their conjugates; see butterflies
+                template<class Rep, int Exponent>
+                struct cooley_tukey_key {
+                    using value_type = std::complex<fixed_point<Rep, Exponent>>;
+                    using function = void(const value_type*, std::size_t, int, bool, std::size_t, std::size_t,
+                            value_type*);
+
+                    static void scalar(
+                            const value_type* twiddles, std::size_t n, int q, bool inverse,
+                            std::size_t first, std::size_t last, value_type* data)
+                    {
+                        auto const l = std::size_t{1} << q;
+                        auto const l_s = std::size_t{1} << (q-1);
+                        auto const r = n >> q;
+                        auto const block = butterflies(first, last, l_s);
+                        for (auto j = block.column_first; j!=block.column_last; ++j) {
+                            auto const w = twiddle_factor(twiddles, j*r, inverse);
+                            for (auto k = block.row_first; k!=block.row_last; ++k) {
+                                auto const tau = complex_product(w, data[k*l+j+l_s]);
+                                data[k*l+j+l_s] = complex_difference(data[k*l+j], tau);
+                                data[k*l+j] = complex_sum(data[k*l+j], tau);
+                            }
+                        }
+                    }
+
+                    template<instruction_set Set>
+                    static constexpr bool uses()
+                    {
+                        return fft_vectorizable<Rep, Exponent>::value;
+                    }
+
+                    static constexpr dispatch::table<function> entries()
+                    {
+                        return make_table<cooley_tukey_key>();
+                    }
+                };
+
+                // the overflow tags supported by the batch conversion functions
+                template<class OverflowTag>
+                struct saturates;
+
+                template<>
+                struct saturates<native_overflow_tag> : std::false_type {
+                };
+
+                template<>
+                struct saturates<saturated_overflow_tag> : std::true_type {
+                };
+
+                // the rounding tags supported by the batch conversion functions
+                template<class RoundingTag>
+                struct rounds : std::false_type {
+                };
+
+                template<>
+                struct rounds<closest_rounding_tag> : std::true_type {
+                };
+
+                // converts [first, last) to fixed-point using the given instruction set, which must be supported
+                template<bool Saturate, bool Round, class Float, class Rep, int Exponent>
+                fixed_point<Rep, Exponent>* convert(
+                        instruction_set set, const Float* first, const Float* last, fixed_point<Rep, Exponent>* d_first)
+                {
+                    return dispatch::registry<to_fixed_key<Float, Rep, Exponent, Saturate, Round>>::select(set)(
+                            first, last, d_first);
+                }
+
+                template<bool Saturate, bool Round, class Float, class Rep, int Exponent>
+                fixed_point<Rep, Exponent>* convert(
+                        const Float* first, const Float* last, fixed_point<Rep, Exponent>* d_first)
+                {
+                    return dispatch::registry<to_fixed_key<Float, Rep, Exponent, Saturate, Round>>::selected()(
+                            first, last, d_first);
+                }
+
+                // converts [first, last) to floating-point using the given instruction set, which must be supported
+                template<class Rep, int Exponent, class Float>
+                Float* convert(
+                        instruction_set set, const fixed_point<Rep, Exponent>* first,
+                        const fixed_point<Rep, Exponent>* last, Float* d_first)
+                {
+                    return dispatch::registry<to_float_key<Rep, Exponent, Float>>::select(set)(first, last, d_first);
+                }
+
+                template<class Rep, int Exponent, class Float>
+                Float* convert(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                        Float* d_first)
+                {
+                    return dispatch::registry<to_float_key<Rep, Exponent, Float>>::selected()(first, last, d_first);
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // batch math functions
+    //
+    // Each function writes the result of the scalar function for each value in [first, last)
+    // to the output range beginning at d_first, which may equal first.
+    // Values of up to 32 bits are processed several at a time using the vector instructions
+    // of selected_instruction_set(). The results do not depend on the instructions used.
+
+    /// \brief calculates the absolute values of the contiguous range, [first, last)
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note Unlike \ref abs, the result has the type of the input,
+    /// so the magnitude of the most negative value saturates.
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    abs(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::abs_kernel>(first, last, d_first);
+    }
+
+    /// \brief calculates the square roots of the contiguous range, [first, last)
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note The root of a negative value is zero.
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    sqrt(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::sqrt_kernel>(first, last, d_first);
+    }
+
+    /// \brief calculates 2 raised to the power of each value of the contiguous range, [first, last)
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note Results which are out of range are saturated.
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    exp2(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::exp2_kernel>(first, last, d_first);
+    }
+
+    /// \brief calculates the base-2 logarithms of the contiguous range, [first, last)
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note The logarithm of a non-positive value saturates to the lowest value.
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    log2(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::log2_kernel>(first, last, d_first);
+    }
+
+    /// \brief calculates the sines of the contiguous range, [first, last), of angles in radians
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \sa sin
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    sin(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::sin_kernel>(first, last, d_first);
+    }
+
+    /// \brief calculates the cosines of the contiguous range, [first, last), of angles in radians
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \sa cos
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    cos(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::cos_kernel>(first, last, d_first);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // batch arithmetic functions
+    //
+    // Each function applies an arithmetic operator to corresponding values in [first1, last1)
+    // and the range beginning at first2 and converts the result to the type of the operands.
+    // Where the rep is safe_integer<std::int16_t, saturated_overflow_tag> or another 8- or 16-bit saturated
+    // safe_integer, the results are calculated several at a time using the saturating vector instructions
+    // of selected_instruction_set(). The results do not depend on the instructions used.
+
+    /// \brief adds the corresponding values of [first1, last1) and the range beginning at first2
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first1 or first2
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    add(const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+            const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::add_op>(first1, last1, first2, d_first);
+    }
+
+    /// \brief subtracts the values of the range beginning at first2 from the corresponding values of [first1, last1)
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first1 or first2
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    subtract(const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+            const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::subtract_op>(first1, last1, first2, d_first);
+    }
+
+    /// \brief multiplies the corresponding values of [first1, last1) and the range beginning at first2
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first1 or first2
+    ///
+    /// \note As with the assignment of a product, fractional digits are dropped, rounding toward zero.
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    multiply(const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+            const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::multiply_op>(first1, last1, first2, d_first);
+    }
+
+    /// \brief multiplies the corresponding values of [first1, last1) and the range beginning at first2
+    /// as \ref q_mul_round
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first1 or first2
+    ///
+    /// \note Q15 and Q31 values are multiplied several at a time with vector instructions,
+    /// e.g. `pmulhrsw` for Q15.
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>*
+    q_mul_round(const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+            const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::transform<_impl::fp::batch::q_mul_round_op>(first1, last1, first2, d_first);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::dot
+
+    /// \brief calculates the sum of the products of corresponding values of [first1, last1)
+    /// and the range beginning at first2
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \tparam MaxLength the greatest number of values in [first1, last1)
+    ///
+    /// \return the sum of products with a representation wide enough to hold that of any MaxLength products
+    /// so that the sum cannot overflow
+    ///
+    /// \note For `fixed_point<std::int16_t, Exponent>` operands, the products of pairs of values
+    /// are summed several at a time with `pmaddwd` and accumulated in 64 bits.
+    template<unsigned long long MaxLength, class LhsRep, int LhsExponent, class RhsRep, int RhsExponent>
+    typename _impl::fp::batch::dot_result<
+            fixed_point<LhsRep, LhsExponent>, fixed_point<RhsRep, RhsExponent>, MaxLength>::type
+    dot(const fixed_point<LhsRep, LhsExponent>* first1, const fixed_point<LhsRep, LhsExponent>* last1,
+            const fixed_point<RhsRep, RhsExponent>* first2)
+    {
+        return _impl::fp::batch::dot<MaxLength>(first1, last1, first2);
+    }
+
+    /// \brief calculates the sum of the products of corresponding values of two arrays of the same length
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return the sum of products with a representation wide enough that it cannot overflow
+    template<class LhsRep, int LhsExponent, class RhsRep, int RhsExponent, std::size_t Length>
+    typename _impl::fp::batch::dot_result<
+            fixed_point<LhsRep, LhsExponent>, fixed_point<RhsRep, RhsExponent>, Length>::type
+    dot(const fixed_point<LhsRep, LhsExponent> (&lhs)[Length], const fixed_point<RhsRep, RhsExponent> (&rhs)[Length])
+    {
+        return _impl::fp::batch::dot<Length>(lhs, lhs+Length, rhs);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // batch conversion functions
+    //
+    // Each function converts each value in [first, last) and writes the result
+    // to the output range beginning at d_first.
+    // Conversions between float or double and values of up to 32 bits are performed several at a time
+    // using the vector instructions of selected_instruction_set(). The results do not depend on the
+    // instructions used.
+
+    /// \brief converts the contiguous range of floating-point values, [first, last), to fixed-point
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note As with the conversion of a single value, results are rounded toward zero
+    /// and are unspecified if out of range.
+    template<class Float, class Rep, int Exponent>
+    _impl::enable_if_t<std::numeric_limits<Float>::is_iec559, fixed_point<Rep, Exponent>*>
+    convert(const Float* first, const Float* last, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::convert<false, false>(first, last, d_first);
+    }
+
+    /// \brief converts the contiguous range of floating-point values, [first, last), to fixed-point
+    /// with the given overflow behavior
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \param tag \ref native_overflow or \ref saturated_overflow of sg14/auxiliary/overflow.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note Results are rounded toward zero. With \ref saturated_overflow, they are confined to the range
+    /// of the result and NaN is converted to zero; with \ref native_overflow, results which are out of range
+    /// are unspecified.
+    template<class OverflowTag, class Float, class Rep, int Exponent>
+    _impl::enable_if_t<std::numeric_limits<Float>::is_iec559, fixed_point<Rep, Exponent>*>
+    convert(OverflowTag, const Float* first, const Float* last, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::convert<_impl::fp::batch::saturates<OverflowTag>::value, false>(
+                first, last, d_first);
+    }
+
+    /// \brief converts the contiguous range of floating-point values, [first, last), to fixed-point
+    /// with the given overflow behavior, rounding to the nearest value
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \param tag \ref native_overflow or \ref saturated_overflow of sg14/auxiliary/overflow.h
+    /// \param rounding \ref closest_rounding_tag of sg14/auxiliary/precise_integer.h
+    ///
+    /// \return end of the output range beginning at d_first
+    ///
+    /// \note As with \ref closest_rounding_tag, halves are rounded away from zero. With \ref native_overflow,
+    /// results which are rounded out of range, such as the maximum plus half the smallest step, are unspecified.
+    template<class OverflowTag, class RoundingTag, class Float, class Rep, int Exponent>
+    _impl::enable_if_t<std::numeric_limits<Float>::is_iec559 && _impl::fp::batch::rounds<RoundingTag>::value,
+            fixed_point<Rep, Exponent>*>
+    convert(OverflowTag, RoundingTag, const Float* first, const Float* last, fixed_point<Rep, Exponent>* d_first)
+    {
+        return _impl::fp::batch::convert<_impl::fp::batch::saturates<OverflowTag>::value, true>(
+                first, last, d_first);
+    }
+
+    /// \brief converts the contiguous range of fixed-point values, [first, last), to floating-point
+    /// \headerfile sg14/auxiliary/batch.h
+    ///
+    /// \return end of the output range beginning at d_first
+    template<class Rep, int Exponent, class Float>
+    _impl::enable_if_t<std::numeric_limits<Float>::is_iec559, Float*>
+    convert(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last, Float* d_first)
+    {
+        return _impl::fp::batch::convert(first, last, d_first);
+    }
+}
+
+#endif	// SG14_FIXED_POINT_BATCH_H
@@ -13,6 +13,7 @@
 #define SG14_FIXED_POINT_EXTRAS_H 1
 
 #include "fixed_point_type.h"
+#include "fixed_point_working.h"
 
 #include <cmath>
 #include <istream>
@@ -101,6 +102,126 @@ namespace sg14 {
                 {
                     return sqrt_solve3<Rep>(n, sqrt_bit<Rep>(n), Rep{0});
                 }
+
+                // fast path for fundamental integers:
+                // a count-leading-zeros seed is refined with a fixed number of Newton steps
+
+                // sqrt_native<Rep>::type is the unsigned integer in which sqrt of Rep is calculated
+                template<class Rep, class Enable = void>
+                struct sqrt_native {
+                    static constexpr bool value = false;
+                };
+
+#if !defined(_MSC_VER) && !defined(SG14_DISABLE_GCC_BUILTINS)
+                template<class Rep>
+                struct sqrt_native<Rep, enable_if_t<std::is_integral<Rep>::value && sizeof(Rep)<=sizeof(unsigned)>> {
+                    static constexpr bool value = true;
+                    using type = unsigned;
+                };
+
+                template<class Rep>
+                struct sqrt_native<Rep, enable_if_t<std::is_integral<Rep>::value && (sizeof(Rep)>sizeof(unsigned))
+                                                    && sizeof(Rep)<=sizeof(unsigned long long)>> {
+                    static constexpr bool value = true;
+                    using type = unsigned long long;
+                };
+
+                constexpr int sqrt_leading_zeros(unsigned n)
+                {
+                    return __builtin_clz(n);
+                }
+
+                constexpr int sqrt_leading_zeros(unsigned long long n)
+                {
+                    return __builtin_clzll(n);
+                }
+
+#if defined(SG14_INT128_ENABLED)
+                template<>
+                struct sqrt_native<SG14_INT128> {
+                    static constexpr bool value = true;
+                    using type = SG14_UINT128;
+                };
+
+                template<>
+                struct sqrt_native<SG14_UINT128> {
+                    static constexpr bool value = true;
+                    using type = SG14_UINT128;
+                };
+
+                constexpr int sqrt_leading_zeros(SG14_UINT128 n)
+                {
+                    return (n >> 64)
+                           ? __builtin_clzll(static_cast<unsigned long long>(n >> 64))
+                           : 64+__builtin_clzll(static_cast<unsigned long long>(n));
+                }
+#endif
+#endif
+
+                // number of Newton steps which follow sqrt_seed to give a result with the given number of digits;
+                // the seed is within 1/4 of the root and the precision (in bits) of each step is at least 2p+1
+                constexpr int sqrt_steps(int result_digits, int precision = 5)
+                {
+                    return (precision>=result_digits) ? 1 : 1+sqrt_steps(result_digits, precision*2+1);
+                }
+
+                // one shift-only Newton step from 2^half_digits, which is no less than the root
+                template<class Uint>
+                constexpr Uint sqrt_seed(Uint n, int half_digits)
+                {
+                    return ((n >> half_digits)+(Uint{1} << half_digits)) >> 1;
+                }
+
+                template<class Uint>
+                constexpr Uint sqrt_seed(Uint n)
+                {
+                    return sqrt_seed(n, (digits<Uint>::value-sqrt_leading_zeros(n)+1)/2);
+                }
+
+                template<int Steps>
+                struct sqrt_newton {
+                    template<class Uint>
+                    static constexpr Uint refine(Uint n, Uint root)
+                    {
+                        return sqrt_newton<Steps-1>::refine(n, static_cast<Uint>((root+n/root) >> 1));
+                    }
+                };
+
+                template<>
+                struct sqrt_newton<0> {
+                    template<class Uint>
+                    static constexpr Uint refine(Uint, Uint root)
+                    {
+                        return root;
+                    }
+                };
+
+                // Newton's method converges from above and finishes on the root or one more than it;
+                // (root-1)*(root+1) cannot overflow where root*root might
+                template<class Uint>
+                constexpr Uint sqrt_correct(Uint n, Uint root)
+                {
+                    return ((root-1)*(root+1)>=n) ? root-1 : root;
+                }
+
+                template<class Uint, int ResultDigits>
+                constexpr Uint sqrt_fast(Uint n)
+                {
+                    return n ? sqrt_correct(n, sqrt_newton<sqrt_steps(ResultDigits)>::refine(n, sqrt_seed(n))) : n;
+                }
+
+                template<class Rep>
+                constexpr enable_if_t<!sqrt_native<Rep>::value, Rep> sqrt_solve(Rep n)
+                {
+                    return sqrt_solve1<Rep>(n);
+                }
+
+                template<class Rep>
+                constexpr enable_if_t<sqrt_native<Rep>::value, Rep> sqrt_solve(Rep n)
+                {
+                    return static_cast<Rep>(sqrt_fast<typename sqrt_native<Rep>::type, (digits<Rep>::value+1)/2>(
+                            static_cast<typename sqrt_native<Rep>::type>(n)));
+                }
             }
         }
     }
@@ -115,10 +236,9 @@ namespace sg14 {
     ///
     /// \return square root of x
     ///
-    /// \note This function is a placeholder implementation with poor run-time performance characteristics.
-    /// \note It uses
-    /// divides the values
-    /// without performing any additional scaling or conversion.
+    /// \note Where the widened representation is a fundamental integer,
+    /// the root is seeded from a count of leading zeros and refined with a fixed number of Newton steps;
+    /// otherwise it is calculated one bit at a time.
     ///
     /// \sa negate, add, subtract, multiply
 
@@ -135,57 +255,413 @@ namespace sg14 {
                 ? throw std::invalid_argument("cannot represent square root of negative value") :
 #endif
                 fixed_point<Rep, Exponent>::from_data(
-                        static_cast<Rep>(_impl::fp::extras::sqrt_solve1(widened_type{x}.data())));
+                        static_cast<Rep>(_impl::fp::extras::sqrt_solve(widened_type{x}.data())));
     }
 
     ////////////////////////////////////////////////////////////////////////////////
-    // sg14::trig
-    //
-    // Placeholder implementations fall back on <cmath> functions which is slow
-    // due to conversion to and from floating-point types; also inconvenient as
-    // many <cmath> functions are not constexpr.
+    // sg14::rsqrt helper functions
 
     namespace _impl {
         namespace fp {
             namespace extras {
-                template<class Rep, int Exponent, _impl::fp::float_of_same_size<Rep>(* F)(
-                        _impl::fp::float_of_same_size<Rep>)>
-                constexpr fixed_point <Rep, Exponent>
-                crib(const fixed_point <Rep, Exponent>& x) noexcept
+                using working::uworking_rep;
+
+                // linear approximations, offset - slope*m, to 1/sqrt(m) in Q62
+                // with relative error below 2.3% over [.25, .5) and [.5, 1)
+                template<class Dummy = void>
+                struct rsqrt_constants {
+                    static constexpr uworking_rep lower_offset = 0xa1ce7eb126987000;
+                    static constexpr uworking_rep lower_slope = 0x929f8f7302de5000;
+                    static constexpr uworking_rep upper_offset = 0x726a208517623000;
+                    static constexpr uworking_rep upper_slope = 0x33d6d31ae471c400;
+                };
+
+                template<class Dummy>
+                constexpr uworking_rep rsqrt_constants<Dummy>::lower_offset;
+                template<class Dummy>
+                constexpr uworking_rep rsqrt_constants<Dummy>::lower_slope;
+                template<class Dummy>
+                constexpr uworking_rep rsqrt_constants<Dummy>::upper_offset;
+                template<class Dummy>
+                constexpr uworking_rep rsqrt_constants<Dummy>::upper_slope;
+
+                // number of Newton steps which follow rsqrt_seed to give a result with the given number of digits;
+                // the seed is good to 5 bits and the precision of each step is at least 2p-1
+                constexpr int rsqrt_steps(int result_digits, int precision = 5)
+                {
+                    return (precision>result_digits) ? 0 : 1+rsqrt_steps(result_digits, precision*2-1);
+                }
+
+                // m is in Q64 and in the range [.25, 1); result is in Q62
+                constexpr uworking_rep rsqrt_seed(uworking_rep m)
                 {
-                    using floating_point = _impl::fp::float_of_same_size<Rep>;
-                    return static_cast<fixed_point<Rep, Exponent>>(F(static_cast<floating_point>(x)));
+                    return (m<(uworking_rep{1} << 63))
+                           ? rsqrt_constants<>::lower_offset-multiply_high(rsqrt_constants<>::lower_slope, m)
+                           : rsqrt_constants<>::upper_offset-multiply_high(rsqrt_constants<>::upper_slope, m);
+                }
+
+                // y' = y*(3-m*y*y)/2 where y and the intermediate, 3-m*y*y, are in Q62
+                constexpr uworking_rep rsqrt_step(uworking_rep m, uworking_rep y)
+                {
+                    return multiply_high(y, (uworking_rep{3} << 62)-(multiply_high(m, multiply_high(y, y)) << 2)) << 1;
+                }
+
+                template<int Steps>
+                struct rsqrt_newton {
+                    static constexpr uworking_rep refine(uworking_rep m, uworking_rep y)
+                    {
+                        return rsqrt_newton<Steps-1>::refine(m, rsqrt_step(m, y));
+                    }
+                };
+
+                template<>
+                struct rsqrt_newton<0> {
+                    static constexpr uworking_rep refine(uworking_rep, uworking_rep y)
+                    {
+                        return y;
+                    }
+                };
+
+                // 1/sqrt(m*2^(2*half_power)) where m is in Q64 and in the range [.25, 1)
+                template<class Rep, int Steps>
+                constexpr Rep rsqrt_normalized(uworking_rep m, int half_power, int result_fractional_digits)
+                {
+                    // rounded to Q61 as 1/sqrt(.25) does not fit in working_rep as Q62
+                    return working::scale<Rep>(
+                            static_cast<working::working_rep>((rsqrt_newton<Steps>::refine(m, rsqrt_seed(m))+1) >> 1),
+                            result_fractional_digits-half_power-61);
+                }
+
+                // the magnitude is normalized such that the power of two by which it is scaled is even
+                template<class Rep, int Steps>
+                constexpr Rep rsqrt_positive(uworking_rep magnitude, int power, int result_fractional_digits)
+                {
+                    return rsqrt_normalized<Rep, Steps>(
+                            (magnitude << (64-working::used_bits(magnitude))) >> (power & 1),
+                            (power+(power & 1))/2, result_fractional_digits);
+                }
+
+                // 1/sqrt of zero and negative values saturate
+                template<class Rep>
+                constexpr Rep rsqrt_rep(Rep rep, int fractional_digits, int result_fractional_digits)
+                {
+                    return (rep<=Rep{0})
+                           ? working::saturate<Rep>(std::numeric_limits<working::working_rep>::max())
+                           : rsqrt_positive<Rep, rsqrt_steps(digits<Rep>::value+1)>(
+                                    working::rep_traits<Rep>::magnitude(rep),
+                                    working::used_bits(working::rep_traits<Rep>::magnitude(rep))-fractional_digits,
+                                    result_fractional_digits);
                 }
             }
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::rsqrt
+
+    /// \brief calculates the reciprocal square root of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam ResultExponent exponent of the result
+    /// \param x input parameter
+    ///
+    /// \return 1/sqrt(x) with the same representation as x and the given exponent
+    ///
+    /// \note Calculated with integer Newton-Raphson iterations which avoid the wide division of `1/sqrt(x)`.
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range, including that of zero, are saturated.
+    ///
+    /// \sa sqrt
+    template<int ResultExponent, class Rep, int Exponent>
+    constexpr fixed_point<Rep, ResultExponent>
+    rsqrt(const fixed_point<Rep, Exponent>& x)
+    {
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x<fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot represent reciprocal square root of negative value") :
+#endif
+                fixed_point<Rep, ResultExponent>::from_data(
+                        _impl::fp::extras::rsqrt_rep<Rep>(x.data(), -Exponent, -ResultExponent));
+    }
+
+    /// \brief calculates the reciprocal square root of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return 1/sqrt(x) with the same type as x
     template<class Rep, int Exponent>
-    constexpr fixed_point <Rep, Exponent>
-    sin(const fixed_point <Rep, Exponent>& x) noexcept
+    constexpr fixed_point<Rep, Exponent>
+    rsqrt(const fixed_point<Rep, Exponent>& x)
+    {
+        return rsqrt<Exponent>(x);
+    }
+
+    /// \brief calculates the reciprocal square roots of the contiguous range, [first, last)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return end of the output range beginning at d_first, whose exponent is that of the results
+    template<class Rep, int Exponent, int ResultExponent>
+    fixed_point<Rep, ResultExponent>*
+    rsqrt(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, ResultExponent>* d_first)
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::sin>(x);
+        for (; first!=last; ++first, ++d_first) {
+            *d_first = rsqrt<ResultExponent>(*first);
+        }
+        return d_first;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::reciprocal helper functions
+
+    namespace _impl {
+        namespace fp {
+            namespace extras {
+                using working::working_rep;
+                using working::uworking_rep;
+
+                // linear approximation, offset - slope*m, to 1/m in Q62
+                // with relative error below 1/17 over [.5, 1)
+                template<class Dummy = void>
+                struct reciprocal_constants {
+                    static constexpr uworking_rep offset = 0xb4b4b4b4b4b4b4b5;
+                    static constexpr uworking_rep slope = 0x7878787878787878;
+                };
+
+                template<class Dummy>
+                constexpr uworking_rep reciprocal_constants<Dummy>::offset;
+                template<class Dummy>
+                constexpr uworking_rep reciprocal_constants<Dummy>::slope;
+
+                // number of Newton steps which follow reciprocal_seed to give a result with the given number of digits;
+                // the seed is good to 4 bits and the precision of each step is at least 2p-1
+                constexpr int reciprocal_steps(int result_digits, int precision = 4)
+                {
+                    return (precision>result_digits) ? 0 : 1+reciprocal_steps(result_digits, precision*2-1);
+                }
+
+                // m is in Q64 and in the range [.5, 1); result is in Q62
+                constexpr uworking_rep reciprocal_seed(uworking_rep m)
+                {
+                    return reciprocal_constants<>::offset-multiply_high(reciprocal_constants<>::slope, m);
+                }
+
+                // y' = y*(2-m*y) where y is in Q62 and the intermediate, 2-m*y, is in Q63
+                constexpr uworking_rep reciprocal_step(uworking_rep m, uworking_rep y)
+                {
+                    return multiply_high(y, ((uworking_rep{1} << 63)-multiply_high(m, y)) << 1) << 1;
+                }
+
+                template<int Steps>
+                struct reciprocal_newton {
+                    static constexpr uworking_rep refine(uworking_rep m, uworking_rep y)
+                    {
+                        return reciprocal_newton<Steps-1>::refine(m, reciprocal_step(m, y));
+                    }
+                };
+
+                template<>
+                struct reciprocal_newton<0> {
+                    static constexpr uworking_rep refine(uworking_rep, uworking_rep y)
+                    {
+                        return y;
+                    }
+                };
+
+                // 1/m in Q61 where m is in Q64 and in the range [.5, 1);
+                // rounded to Q61 as 1/.5 does not fit in working_rep as Q62
+                template<int Steps>
+                constexpr working_rep reciprocal_normalized(uworking_rep m)
+                {
+                    return static_cast<working_rep>((reciprocal_newton<Steps>::refine(m, reciprocal_seed(m))+1) >> 1);
+                }
+
+                // non-zero magnitude shifted left until its most significant bit is set
+                constexpr uworking_rep normalize(uworking_rep magnitude)
+                {
+                    return magnitude << (64-working::used_bits(magnitude));
+                }
+
+                // the reciprocal of a value as its sign and magnitude, reciprocal*2^exponent,
+                // where reciprocal is in Q61; that of zero is so large that any non-zero product saturates
+                struct reciprocal_working {
+                    bool negative;
+                    working_rep reciprocal;
+                    int exponent;
+                };
+
+                template<int Steps, class Rep>
+                constexpr reciprocal_working make_reciprocal(Rep rep, int fractional_digits)
+                {
+                    return (rep==Rep{0})
+                           ? reciprocal_working{false, working_rep{1} << 61, 1024}
+                           : reciprocal_working{
+                                    working::rep_traits<Rep>::negative(rep),
+                                    reciprocal_normalized<Steps>(normalize(working::rep_traits<Rep>::magnitude(rep))),
+                                    fractional_digits-working::used_bits(working::rep_traits<Rep>::magnitude(rep))-61};
+                }
+
+                template<class Rep>
+                constexpr Rep reciprocal_rep(reciprocal_working r, int result_fractional_digits)
+                {
+                    return working::scale<Rep>(working::negate_if(r.negative, r.reciprocal),
+                            r.exponent+result_fractional_digits);
+                }
+
+                // n*r where the dividend, n, and the quotient have the same exponent
+                template<class Rep>
+                constexpr Rep divide_rep(Rep n, reciprocal_working r)
+                {
+                    return (n==Rep{0})
+                           ? Rep{0}
+                           : working::scale<Rep>(
+                                    working::negate_if(working::rep_traits<Rep>::negative(n)!=r.negative,
+                                            static_cast<working_rep>(multiply_high(
+                                                    normalize(working::rep_traits<Rep>::magnitude(n)),
+                                                    static_cast<uworking_rep>(r.reciprocal)))),
+                                    working::used_bits(working::rep_traits<Rep>::magnitude(n))+r.exponent);
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::reciprocal
+
+    /// \brief calculates the reciprocal of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam ResultExponent exponent of the result
+    /// \param x input parameter
+    ///
+    /// \return 1/x with the same representation as x and the given exponent
+    ///
+    /// \note Calculated with integer Newton-Raphson iterations which avoid the wide division of `1/x`.
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range, including that of zero, are saturated.
+    ///
+    /// \sa reciprocal_divisor, rsqrt
+    template<int ResultExponent, class Rep, int Exponent>
+    constexpr fixed_point<Rep, ResultExponent>
+    reciprocal(const fixed_point<Rep, Exponent>& x)
+    {
+        return fixed_point<Rep, ResultExponent>::from_data(
+                _impl::fp::extras::reciprocal_rep<Rep>(
+                        _impl::fp::extras::make_reciprocal<_impl::fp::extras::reciprocal_steps(digits<Rep>::value+1)>(
+                                x.data(), -Exponent),
+                        -ResultExponent));
+    }
+
+    /// \brief calculates the reciprocal of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return 1/x with the same type as x
     template<class Rep, int Exponent>
-    constexpr fixed_point <Rep, Exponent>
-    cos(const fixed_point <Rep, Exponent>& x) noexcept
+    constexpr fixed_point<Rep, Exponent>
+    reciprocal(const fixed_point<Rep, Exponent>& x)
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::cos>(x);
+        return reciprocal<Exponent>(x);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::reciprocal_divisor
+
+    // divide by multiplying the dividend by the Newton-refined reciprocal of the divisor
+    static constexpr struct reciprocal_division_tag {
+    } reciprocal_division{};
+
+    /// \brief a \ref fixed_point divisor together with its reciprocal
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \note Calculating the reciprocal once and multiplying by it replaces a wide division
+    /// per dividend with a 64-bit multiplication.
+    /// Quotients are accurate to 1LSB for up to 32 bit underlying representation
+    /// and saturated when out of range, including those of non-zero dividends by a zero divisor.
+    ///
+    /// \sa reciprocal, reciprocal_division_tag
     template<class Rep, int Exponent>
-    constexpr fixed_point <Rep, Exponent>
-    exp(const fixed_point <Rep, Exponent>& x) noexcept
+    class reciprocal_divisor {
+    public:
+        using divisor_type = fixed_point<Rep, Exponent>;
+
+        explicit constexpr reciprocal_divisor(const divisor_type& d)
+                :_divisor(d),
+                 _reciprocal(_impl::fp::extras::make_reciprocal<_impl::fp::extras::reciprocal_steps(64)>(
+                         d.data(), -Exponent)) { }
+
+        /// returns the divisor
+        constexpr divisor_type divisor() const
+        {
+            return _divisor;
+        }
+
+        /// returns dividend/divisor() with the type of dividend
+        template<class DividendRep, int DividendExponent>
+        constexpr fixed_point<DividendRep, DividendExponent>
+        quotient(const fixed_point<DividendRep, DividendExponent>& dividend) const
+        {
+            return fixed_point<DividendRep, DividendExponent>::from_data(
+                    _impl::fp::extras::divide_rep<DividendRep>(dividend.data(), _reciprocal));
+        }
+
+    private:
+        divisor_type _divisor;
+        _impl::fp::extras::reciprocal_working _reciprocal;
+    };
+
+    /// \brief calculates the quotient of two \ref fixed_point values by multiplying by a reciprocal
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return lhs/rhs with the type of lhs
+    ///
+    /// \note The reciprocal of rhs is only as precise as the result requires.
+    /// To divide many values by the same divisor, use \ref reciprocal_divisor.
+    template<class LhsRep, int LhsExponent, class RhsRep, int RhsExponent>
+    constexpr fixed_point<LhsRep, LhsExponent>
+    divide(const fixed_point<LhsRep, LhsExponent>& lhs, const fixed_point<RhsRep, RhsExponent>& rhs,
+            reciprocal_division_tag)
+    {
+        return fixed_point<LhsRep, LhsExponent>::from_data(_impl::fp::extras::divide_rep<LhsRep>(
+                lhs.data(),
+                _impl::fp::extras::make_reciprocal<_impl::fp::extras::reciprocal_steps(digits<LhsRep>::value+1)>(
+                        rhs.data(), -RhsExponent)));
+    }
+
+    /// \brief divides each value in the contiguous range, [first, last), by the same divisor
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return end of the output range beginning at d_first
+    template<class Rep, int Exponent, class DivisorRep, int DivisorExponent>
+    fixed_point<Rep, Exponent>*
+    divide(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            const reciprocal_divisor<DivisorRep, DivisorExponent>& divisor, fixed_point<Rep, Exponent>* d_first)
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::exp>(x);
+        for (; first!=last; ++first, ++d_first) {
+            *d_first = divisor.quotient(*first);
+        }
+        return d_first;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::q_mul_round
+
+    /// \brief multiplies two \ref fixed_point values of the same type, rounding the product to that type
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return lhs*rhs rounded to the nearest value of the operand type, with ties rounded up,
+    /// and saturated to its range
+    ///
+    /// \note For Q15, `fixed_point<std::int16_t, -15>`, this is the ETSI/ITU-T basic operator, `mult_r`,
+    /// and for Q31, `fixed_point<std::int32_t, -31>`, its 32-bit counterpart.
+    /// In both, the only product out of range is that of -1 and -1, which saturates to the maximum value.
     template<class Rep, int Exponent>
-    constexpr fixed_point <Rep, Exponent>
-    pow(const fixed_point <Rep, Exponent>& x) noexcept
+    constexpr fixed_point<Rep, Exponent>
+    q_mul_round(const fixed_point<Rep, Exponent>& lhs, const fixed_point<Rep, Exponent>& rhs)
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::pow>(x);
+        static_assert(std::is_integral<Rep>::value && is_signed<Rep>::value && digits<Rep>::value<=31,
+                "sg14::q_mul_round requires a signed built-in representation of up to 32 bits");
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::working::scale<Rep>(
+                static_cast<_impl::fp::working::working_rep>(lhs.data())*rhs.data(), Exponent));
     }
 
     ////////////////////////////////////////////////////////////////////////////////
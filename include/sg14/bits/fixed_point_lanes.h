@@ -0,0 +1,1570 @@
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief vector kernels of the batch math functions of the `sg14::fixed_point` type;
+/// included from sg14/bits/fixed_point_batch.h once per instruction set - do not include directly!
+///
+/// SG14_LANES_BYTES, the width of a vector register in bytes, selects the instruction set
+/// for which the kernels are compiled. Each kernel holds one value in each 64-bit lane
+/// and follows the integer arithmetic of the scalar function, so their results are identical.
+
+// no include guard: this file is included once for each value of SG14_LANES_BYTES
+
+#if !defined(SG14_LANES_BYTES)
+#error SG14_LANES_BYTES must be defined
+#endif
+
+#if defined(__clang__)
+#if (SG14_LANES_BYTES==16)
+#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+#elif (SG14_LANES_BYTES==32)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif (SG14_LANES_BYTES==64)
+#pragma clang attribute push (__attribute__((target("avx512f,avx512dq,avx512bw"))), apply_to = function)
+#endif
+#else
+#pragma GCC push_options
+// GCC 12 warns of the deliberately undefined operands within some AVX-512 intrinsics
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#if (SG14_LANES_BYTES==16)
+#pragma GCC target("sse4.1")
+#elif (SG14_LANES_BYTES==32)
+#pragma GCC target("avx2")
+#elif (SG14_LANES_BYTES==64)
+#pragma GCC target("avx512f,avx512dq,avx512bw")
+#endif
+#endif
+
+#if (SG14_LANES_BYTES==16)
+#define SG14_LANES_NAMESPACE sse4_1
+#define SG14_LANES_INTRINSIC(name) _mm_##name
+#elif (SG14_LANES_BYTES==32)
+#define SG14_LANES_NAMESPACE avx2
+#define SG14_LANES_INTRINSIC(name) _mm256_##name
+#elif (SG14_LANES_BYTES==64)
+#define SG14_LANES_NAMESPACE avx512
+#define SG14_LANES_INTRINSIC(name) _mm512_##name
+#else
+#error unsupported value of SG14_LANES_BYTES
+#endif
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    namespace _impl {
+        namespace fp {
+            namespace batch {
+                namespace SG14_LANES_NAMESPACE {
+                    using working::working_rep;
+                    using working::uworking_rep;
+
+                    // the number of values processed at once
+                    constexpr int width = SG14_LANES_BYTES/8;
+
+                    typedef working_rep lanes __attribute__((vector_size(SG14_LANES_BYTES)));
+                    typedef uworking_rep ulanes __attribute__((vector_size(SG14_LANES_BYTES)));
+                    typedef double dlanes __attribute__((vector_size(SG14_LANES_BYTES)));
+
+                    // the operand types of the intrinsic functions
+                    typedef long long integer_register __attribute__((vector_size(SG14_LANES_BYTES)));
+                    typedef double double_register __attribute__((vector_size(SG14_LANES_BYTES)));
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // lane-wise counterparts of the helpers in fixed_point_working.h
+
+                    inline lanes broadcast(working_rep n)
+                    {
+                        return lanes{}+n;
+                    }
+
+                    inline ulanes broadcast(uworking_rep n)
+                    {
+                        return ulanes{}+n;
+                    }
+
+                    // comparisons yield a lane of all ones where true and zero where false
+                    inline lanes less(lanes lhs, lanes rhs)
+                    {
+                        return (lanes)(lhs<rhs);
+                    }
+
+                    inline lanes less(ulanes lhs, ulanes rhs)
+                    {
+                        return (lanes)(lhs<rhs);
+                    }
+
+                    inline lanes equal(ulanes lhs, ulanes rhs)
+                    {
+                        return (lanes)(lhs==rhs);
+                    }
+
+                    inline lanes select(lanes mask, lanes if_set, lanes if_clear)
+                    {
+                        return (if_set & mask) | (if_clear & ~mask);
+                    }
+
+                    inline ulanes select(lanes mask, ulanes if_set, ulanes if_clear)
+                    {
+                        return (if_set & (ulanes)mask) | (if_clear & ~(ulanes)mask);
+                    }
+
+                    inline lanes negate_if(lanes mask, lanes n)
+                    {
+                        return (n ^ mask)-mask;
+                    }
+
+                    // product of the low 32 bits of each lane
+                    inline ulanes multiply_low32(ulanes lhs, ulanes rhs)
+                    {
+                        return (ulanes)SG14_LANES_INTRINSIC(mul_epu32)((integer_register)lhs, (integer_register)rhs);
+                    }
+
+                    // the upper 64 bits of the 128-bit product, as _impl::multiply_high
+                    inline ulanes multiply_high(ulanes lhs, ulanes rhs)
+                    {
+                        auto const lower = broadcast(uworking_rep{0xffffffff});
+                        auto const ll = multiply_low32(lhs, rhs);
+                        auto const lh = multiply_low32(lhs, rhs >> 32);
+                        auto const hl = multiply_low32(lhs >> 32, rhs);
+                        auto const hh = multiply_low32(lhs >> 32, rhs >> 32);
+                        auto const middle = (ll >> 32)+(lh & lower)+(hl & lower);
+                        return hh+(lh >> 32)+(hl >> 32)+(middle >> 32);
+                    }
+
+                    // a non-zero magnitude shifted so that its highest bit is set and the number of bits it used
+                    struct normalized {
+                        ulanes mantissa;
+                        lanes used;
+                    };
+
+                    inline normalized normalize(ulanes magnitude)
+                    {
+                        auto used = broadcast(working_rep{64});
+                        for (auto shift = 32; shift; shift >>= 1) {
+                            auto const clear = equal(magnitude >> (64-shift), ulanes{});
+                            magnitude = select(clear, magnitude << shift, magnitude);
+                            used -= clear & shift;
+                        }
+                        return normalized{magnitude, used};
+                    }
+
+                    template<class Rep>
+                    lanes saturate(lanes n)
+                    {
+                        return select(
+                                less(broadcast(working::rep_max<Rep>()), n),
+                                broadcast(working::rep_max<Rep>()),
+                                select(less(n, broadcast(working::rep_traits<Rep>::min())),
+                                        broadcast(working::rep_traits<Rep>::min()), n));
+                    }
+
+                    // as working::scale for a shift which rounds to nearest
+                    template<class Rep, int Shift>
+                    lanes scale(lanes n)
+                    {
+                        static_assert(Shift<0 && Shift>-64, "shift is outside the range of the vector kernels");
+                        return saturate<Rep>((n >> -Shift)+((n >> (-Shift-1)) & 1));
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // abs; as many values as fit in a vector are processed at the width of Rep
+
+                    template<class Rep, int Exponent>
+                    fixed_point<Rep, Exponent>* transform(
+                            abs_kernel, const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            fixed_point<Rep, Exponent>* d_first)
+                    {
+                        typedef Rep reps __attribute__((vector_size(SG14_LANES_BYTES)));
+                        typedef make_unsigned_t<Rep> ureps __attribute__((vector_size(SG14_LANES_BYTES)));
+                        constexpr int rep_width = SG14_LANES_BYTES/sizeof(Rep);
+                        for (; last-first>=rep_width; first += rep_width, d_first += rep_width) {
+                            reps n;
+                            __builtin_memcpy(&n, static_cast<const void*>(first), sizeof(n));
+                            // where negative, the complement plus one; the most negative value becomes the maximum
+                            auto const sign = (ureps)(n >> (is_signed<Rep>::value ? digits<Rep>::value : 0))
+                                              & (ureps)(reps{}+(is_signed<Rep>::value ? -1 : 0));
+                            auto const magnitude = (reps)(((ureps)n ^ sign)-sign);
+                            auto const result = magnitude ^ (magnitude >> (is_signed<Rep>::value ? digits<Rep>::value : 0)
+                                                             & (reps{}+(is_signed<Rep>::value ? -1 : 0)));
+                            __builtin_memcpy(static_cast<void*>(d_first), &result, sizeof(result));
+                        }
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = abs_kernel::apply(*first);
+                        }
+                        return d_first;
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // sqrt; the widened value, which is below 2^64, is rounded once on conversion to double
+                    // so the rounded root of the double is the exact root or one more than it
+
+                    inline dlanes to_double(ulanes n)
+                    {
+                        // 2^84 + the upper half * 2^32 and 2^52 + the lower half, both exact
+                        auto const upper = (dlanes)((n >> 32) | broadcast(uworking_rep{0x4530000000000000}));
+                        auto const lower = (dlanes)((n & broadcast(uworking_rep{0xffffffff}))
+                                                    | broadcast(uworking_rep{0x4330000000000000}));
+                        return (upper-(19342813113834066795298816.+4503599627370496.))+lower;
+                    }
+
+                    // the nearest integer to a non-negative double below 2^52
+                    inline ulanes round_to_ulanes(dlanes d)
+                    {
+                        return (ulanes)(d+4503599627370496.) & broadcast(uworking_rep{0x000fffffffffffff});
+                    }
+
+                    inline dlanes sqrt(dlanes d)
+                    {
+                        return (dlanes)SG14_LANES_INTRINSIC(sqrt_pd)((double_register)d);
+                    }
+
+                    template<class Rep, int Exponent>
+                    lanes apply(sqrt_kernel, lanes n)
+                    {
+                        auto const widened = (ulanes)select(less(n, lanes{}), lanes{}, n) << -Exponent;
+                        auto const max_root = broadcast(uworking_rep{0xffffffff});
+                        auto const estimate = round_to_ulanes(sqrt(to_double(widened)));
+                        auto const root = select(less(max_root, estimate), max_root, estimate);
+                        return (lanes)root+less(widened, multiply_low32(root, root));
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // exp2; as sg14::exp2 with Timo Alho's polynomial
+
+                    // as polynomial<Fraction, Coeffs...>::evaluate by Horner's scheme
+                    template<class Fraction, typename Fraction::rep Coeff>
+                    ulanes horner(ulanes)
+                    {
+                        return broadcast(uworking_rep{Coeff});
+                    }
+
+                    template<class Fraction, typename Fraction::rep Coeff, typename Fraction::rep Next, typename Fraction::rep... Tail>
+                    ulanes horner(ulanes x)
+                    {
+                        return (uworking_rep{Coeff}
+                                +((multiply_low32(x, horner<Fraction, Next, Tail...>(x))
+                                   +(uworking_rep{1} << (-Fraction::exponent-1))) >> -Fraction::exponent))
+                                & ((uworking_rep{1} << -Fraction::exponent)-1);
+                    }
+
+                    template<class Fraction, int Precision, std::uint64_t... Coeffs>
+                    ulanes exp2m1(ulanes x, exp2_polynomial<Precision, Coeffs...> const*)
+                    {
+                        return horner<Fraction, 0, coefficient<Fraction>(Coeffs).data()...>(x);
+                    }
+
+                    template<class Rep, int Exponent>
+                    lanes apply(exp2_kernel, lanes n)
+                    {
+                        using fraction = make_largest_ufraction<fixed_point<Rep, Exponent>>;
+                        using coeffs = typename exp2_select<-fraction::exponent>::type;
+                        auto const integer = n >> -Exponent;
+                        auto const power = integer-Exponent;
+                        auto const shift = -fraction::exponent-power;
+                        auto const polynomial = exp2m1<fraction>(
+                                (ulanes)(n & ((working_rep{1} << -Exponent)-1)) << (Exponent-fraction::exponent),
+                                static_cast<coeffs const*>(nullptr));
+                        return select(
+                                less(power, broadcast(working_rep{1})),
+                                broadcast(working_rep{1}),
+                                select(less(power, broadcast(working_rep{digits<Rep>::value})),
+                                        (lanes)((polynomial >> ((ulanes)shift & 63))
+                                                +(broadcast(uworking_rep{1}) << ((ulanes)power & 63))),
+                                        broadcast(working::rep_max<Rep>())));
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // log2; each squaring of the mantissa yields a digit, as fp::log2_digits
+
+                    inline ulanes log2_digits(ulanes mantissa, int n)
+                    {
+                        auto result = ulanes{};
+                        for (auto digit = 0; digit!=n; ++digit) {
+                            auto const square = multiply_high(mantissa, mantissa);
+                            auto const carry = square >> 63;
+                            result = (result << 1) | carry;
+                            mantissa = select((lanes)(ulanes{}-carry), square, square << 1);
+                        }
+                        return result;
+                    }
+
+                    template<class Rep, int Exponent>
+                    lanes apply(log2_kernel, lanes n)
+                    {
+                        constexpr int n_digits = log_digits(-Exponent);
+                        auto const normal = normalize((ulanes)n);
+                        return select(
+                                less(lanes{}, n),
+                                scale<Rep, -Exponent-n_digits>(
+                                        (lanes)((ulanes)(normal.used-(1-Exponent)) << n_digits)
+                                        +(lanes)log2_digits(normal.mantissa, n_digits)),
+                                broadcast(working::rep_traits<Rep>::min()));
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // sin and cos; the CORDIC iteration of fp::trig
+
+                    struct reduced {
+                        lanes quadrant;
+                        lanes angle;
+                    };
+
+                    // as trig::reduce for a non-zero magnitude
+                    inline reduced reduce(ulanes magnitude, int fractional_digits)
+                    {
+                        auto const normal = normalize(magnitude);
+                        auto const quarter_turns = multiply_high(normal.mantissa, broadcast(trig::constants<>::two_over_pi));
+                        auto const digits = (64-normal.used)+fractional_digits;
+                        auto const fraction = select(
+                                less(broadcast(working_rep{64}), digits),
+                                quarter_turns >> ((ulanes)(digits-64) & 63),
+                                quarter_turns << ((ulanes)(64-digits) & 63));
+                        return reduced{
+                                select(less(digits, broadcast(working_rep{64})), (lanes)(quarter_turns >> ((ulanes)digits & 63)), lanes{})
+                                & 3,
+                                (lanes)(multiply_high(fraction, broadcast(trig::constants<>::half_pi)) >> 2)};
+                    }
+
+                    // (cos(angle), sin(angle)) for angle in [0, pi/2]
+                    struct unit_vector {
+                        lanes x, y;
+                    };
+
+                    inline unit_vector rotate(lanes angle, int n)
+                    {
+                        auto x = broadcast(static_cast<working_rep>((trig::constants<>::inverse_gain+4) >> 3));
+                        auto y = lanes{};
+                        for (auto i = 0; i!=n; ++i) {
+                            auto const clockwise = ~(angle >> 63);
+                            auto const dx = negate_if(clockwise, y >> i);
+                            auto const dy = negate_if(clockwise, x >> i);
+                            x += dx;
+                            y -= dy;
+                            angle += negate_if(clockwise, broadcast(trig::constants<>::atan[i]));
+                        }
+                        return unit_vector{x, y};
+                    }
+
+                    inline lanes quadrant_sin(unit_vector v, lanes quadrant)
+                    {
+                        return negate_if(-((quadrant >> 1) & 1), select(-(quadrant & 1), v.x, v.y));
+                    }
+
+                    template<class Rep, int Exponent>
+                    lanes apply(sin_kernel, lanes n)
+                    {
+                        auto const negative = less(n, lanes{});
+                        auto const r = reduce((ulanes)negate_if(negative, n), -Exponent);
+                        return scale<Rep, -Exponent-trig::working_fractional_digits>(select(
+                                equal((ulanes)n, ulanes{}),
+                                lanes{},
+                                negate_if(negative, quadrant_sin(
+                                        rotate(r.angle, trig::iterations(-Exponent+3)), r.quadrant))));
+                    }
+
+                    template<class Rep, int Exponent>
+                    lanes apply(cos_kernel, lanes n)
+                    {
+                        auto const r = reduce((ulanes)negate_if(less(n, lanes{}), n), -Exponent);
+                        return scale<Rep, -Exponent-trig::working_fractional_digits>(select(
+                                equal((ulanes)n, ulanes{}),
+                                broadcast(trig::one),
+                                quadrant_sin(rotate(r.angle, trig::iterations(-Exponent+3)), (r.quadrant+1) & 3)));
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // transform
+
+                    // the given number of bytes beginning at first in the low bytes of a register
+                    inline __m128i load_low(const void* first, std::size_t bytes)
+                    {
+                        auto n = __m128i{};
+                        __builtin_memcpy(&n, first, bytes);
+                        return n;
+                    }
+
+                    // width values of up to 32 bits, sign- or zero-extended to lanes
+                    inline lanes widen(const void* first, std::int8_t)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(cvtepi8_epi64)(load_low(first, width));
+                    }
+
+                    inline lanes widen(const void* first, std::uint8_t)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(cvtepu8_epi64)(load_low(first, width));
+                    }
+
+                    inline lanes widen(const void* first, std::int16_t)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(cvtepi16_epi64)(load_low(first, 2*width));
+                    }
+
+                    inline lanes widen(const void* first, std::uint16_t)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(cvtepu16_epi64)(load_low(first, 2*width));
+                    }
+
+#if (SG14_LANES_BYTES==64)
+                    inline lanes widen(const void* first, std::int32_t)
+                    {
+                        return (lanes)_mm512_cvtepi32_epi64(_mm256_loadu_si256(static_cast<const __m256i*>(first)));
+                    }
+
+                    inline lanes widen(const void* first, std::uint32_t)
+                    {
+                        return (lanes)_mm512_cvtepu32_epi64(_mm256_loadu_si256(static_cast<const __m256i*>(first)));
+                    }
+#else
+                    inline lanes widen(const void* first, std::int32_t)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(cvtepi32_epi64)(load_low(first, 4*width));
+                    }
+
+                    inline lanes widen(const void* first, std::uint32_t)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(cvtepu32_epi64)(load_low(first, 4*width));
+                    }
+#endif
+
+                    // the low 8, 16 or 32 bits of each lane, packed into the low bytes of a register
+#if (SG14_LANES_BYTES==64)
+                    inline __m128i narrow(lanes n, std::integral_constant<int, 1>)
+                    {
+                        return _mm512_cvtepi64_epi8((__m512i)n);
+                    }
+
+                    inline __m128i narrow(lanes n, std::integral_constant<int, 2>)
+                    {
+                        return _mm512_cvtepi64_epi16((__m512i)n);
+                    }
+
+                    inline __m256i narrow(lanes n, std::integral_constant<int, 4>)
+                    {
+                        return _mm512_cvtepi64_epi32((__m512i)n);
+                    }
+#else
+                    inline __m128i narrow(lanes n, std::integral_constant<int, 4>)
+                    {
+#if (SG14_LANES_BYTES==16)
+                        return _mm_shuffle_epi32((__m128i)n, 0xd8);
+#else
+                        return _mm256_castsi256_si128(
+                                _mm256_permutevar8x32_epi32((__m256i)n, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+#endif
+                    }
+
+                    inline __m128i narrow(lanes n, std::integral_constant<int, 2>)
+                    {
+                        return _mm_shuffle_epi8(narrow(n, std::integral_constant<int, 4>{}),
+                                _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+                    }
+
+                    inline __m128i narrow(lanes n, std::integral_constant<int, 1>)
+                    {
+                        return _mm_shuffle_epi8(narrow(n, std::integral_constant<int, 4>{}),
+                                _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+                    }
+#endif
+
+                    template<class Rep, int Exponent>
+                    lanes load(const fixed_point<Rep, Exponent>* first)
+                    {
+                        return widen(static_cast<const void*>(first), set_digits_t<Rep, digits<Rep>::value>{});
+                    }
+
+                    template<class Rep, int Exponent>
+                    void store(lanes n, fixed_point<Rep, Exponent>* d_first)
+                    {
+                        auto const narrowed = narrow(n, std::integral_constant<int, sizeof(Rep)>{});
+                        __builtin_memcpy(static_cast<void*>(d_first), &narrowed, sizeof(Rep)*width);
+                    }
+
+                    // applies Kernel to a range of values, width at a time and the remainder one at a time
+                    template<class Kernel, class Rep, int Exponent>
+                    fixed_point<Rep, Exponent>* transform(
+                            Kernel, const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            fixed_point<Rep, Exponent>* d_first)
+                    {
+                        for (; last-first>=width; first += width, d_first += width) {
+                            store(apply<Rep, Exponent>(Kernel{}, load(first)), d_first);
+                        }
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = Kernel::apply(*first);
+                        }
+                        return d_first;
+                    }
+
+                    template<class Kernel, class Rep, int Exponent>
+                    fixed_point<Rep, Exponent>* transform(
+                            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            fixed_point<Rep, Exponent>* d_first)
+                    {
+                        return transform(Kernel{}, first, last, d_first);
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // conversion between floating-point and fixed-point
+                    //
+                    // Values of up to 32 bits are converted in 32-bit lanes.
+
+                    // the number of values converted at once
+                    constexpr int word_width = SG14_LANES_BYTES/4;
+
+                    typedef std::int32_t words __attribute__((vector_size(SG14_LANES_BYTES)));
+                    typedef std::uint32_t uwords __attribute__((vector_size(SG14_LANES_BYTES)));
+                    typedef float slanes __attribute__((vector_size(SG14_LANES_BYTES)));
+
+                    // each value rounded toward zero
+                    inline slanes truncate(slanes x)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        return _mm512_roundscale_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+                        return SG14_LANES_INTRINSIC(round_ps)(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#endif
+                    }
+
+                    inline dlanes truncate(dlanes x)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        return _mm512_roundscale_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+                        return SG14_LANES_INTRINSIC(round_pd)(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#endif
+                    }
+
+                    // lane-wise counterparts of batch::integral;
+                    // conversion to words rounds toward zero so truncation is left to it
+                    template<class Floats>
+                    Floats integral(Floats x, std::false_type)
+                    {
+                        return x;
+                    }
+
+                    template<class Floats>
+                    Floats integral(Floats x, std::true_type)
+                    {
+                        auto const t = truncate(x);
+                        auto const fraction = x-t;
+                        auto const zero = Floats{};
+                        return t+((fraction>=zero+.5) ? zero+1 : zero)-((fraction<=zero-.5) ? zero+1 : zero);
+                    }
+
+                    // each value rounded toward zero with values out of the range of int32_t unspecified
+                    inline words truncate_to_words(slanes y)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(cvttps_epi32)(y);
+                    }
+
+                    inline words truncate_to_words(dlanes low, dlanes high)
+                    {
+#if (SG14_LANES_BYTES==16)
+                        return (words)_mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+#elif (SG14_LANES_BYTES==32)
+                        return (words)_mm256_inserti128_si256(
+                                _mm256_castsi128_si256(_mm256_cvttpd_epi32(low)), _mm256_cvttpd_epi32(high), 1);
+#else
+                        return (words)_mm512_inserti64x4(
+                                _mm512_castsi256_si512(_mm512_cvttpd_epi32(low)), _mm512_cvttpd_epi32(high), 1);
+#endif
+                    }
+
+                    // the integral values, y, as the values of Rep in 32-bit lanes, as batch::integral_to_rep;
+                    // single precision cannot represent the maximum of a 32-bit Rep
+                    // so overflowing values are selected after conversion
+                    template<class Rep, bool Saturate>
+                    words integral_to_words(slanes y)
+                    {
+                        constexpr auto bound = type::pow2<float, digits<Rep>::value>();
+                        constexpr auto lowest = is_signed<Rep>::value ? -bound : 0.f;
+                        auto const zero = slanes{};
+
+                        auto over = words{};
+                        if (Saturate) {
+                            y = (y==y) ? y : zero;
+                            y = (y<zero+lowest) ? zero+lowest : y;
+                            over = (y>=zero+bound);
+                            y = over ? zero : y;
+                        }
+
+                        // values of uint32_t from 2^31 are offset into the range of int32_t
+                        auto const offset = type::pow2<float, 31>();
+                        auto const n = (digits<Rep>::value==32)
+                                       ? ((y>=zero+offset)
+                                          ? truncate_to_words(y-offset) ^ (words{}+std::numeric_limits<std::int32_t>::min())
+                                          : truncate_to_words(y))
+                                       : truncate_to_words(y);
+
+                        return over ? words{}+static_cast<std::int32_t>(std::numeric_limits<Rep>::max()) : n;
+                    }
+
+                    // double precision represents every value of Rep so saturation precedes conversion
+                    template<class Rep, bool Saturate>
+                    dlanes integral_to_word_range(dlanes y)
+                    {
+                        constexpr auto bound = type::pow2<double, digits<Rep>::value>();
+                        constexpr auto lowest = is_signed<Rep>::value ? -bound : 0.;
+                        auto const zero = dlanes{};
+
+                        if (Saturate) {
+                            y = (y==y) ? y : zero;
+                            y = (y<zero+lowest) ? zero+lowest : y;
+                            y = (y>zero+(bound-1)) ? zero+(bound-1) : y;
+                        }
+
+                        // values of uint32_t are offset into the range of int32_t after truncation,
+                        // which would otherwise round negative offset values toward the wrong integer
+                        return (digits<Rep>::value==32) ? truncate(y)-type::pow2<double, 31>() : y;
+                    }
+
+                    template<class Rep, bool Saturate>
+                    words integral_to_words(dlanes low, dlanes high)
+                    {
+                        auto const n = truncate_to_words(
+                                integral_to_word_range<Rep, Saturate>(low), integral_to_word_range<Rep, Saturate>(high));
+                        return (digits<Rep>::value==32) ? n ^ (words{}+std::numeric_limits<std::int32_t>::min()) : n;
+                    }
+
+                    // the values of Rep in n, stored to word_width values beginning at d_first;
+                    // values out of the range of Rep are unspecified
+                    inline void store_words(words n, void* d_first, std::int32_t)
+                    {
+                        __builtin_memcpy(d_first, &n, sizeof(n));
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint32_t)
+                    {
+                        __builtin_memcpy(d_first, &n, sizeof(n));
+                    }
+
+#if (SG14_LANES_BYTES==64)
+                    inline void store_words(words n, void* d_first, std::int16_t)
+                    {
+                        auto const packed = _mm512_cvtsepi32_epi16((__m512i)n);
+                        __builtin_memcpy(d_first, &packed, sizeof(packed));
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint16_t)
+                    {
+                        auto const packed = _mm512_cvtusepi32_epi16((__m512i)n);
+                        __builtin_memcpy(d_first, &packed, sizeof(packed));
+                    }
+
+                    inline void store_words(words n, void* d_first, std::int8_t)
+                    {
+                        auto const packed = _mm512_cvtsepi32_epi8((__m512i)n);
+                        __builtin_memcpy(d_first, &packed, sizeof(packed));
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint8_t)
+                    {
+                        auto const packed = _mm512_cvtusepi32_epi8((__m512i)n);
+                        __builtin_memcpy(d_first, &packed, sizeof(packed));
+                    }
+#elif (SG14_LANES_BYTES==32)
+                    inline void store_words(words n, void* d_first, std::int16_t)
+                    {
+                        auto const packed = _mm256_castsi256_si128(
+                                _mm256_permute4x64_epi64(_mm256_packs_epi32((__m256i)n, (__m256i)n), 0x08));
+                        __builtin_memcpy(d_first, &packed, sizeof(packed));
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint16_t)
+                    {
+                        auto const packed = _mm256_castsi256_si128(
+                                _mm256_permute4x64_epi64(_mm256_packus_epi32((__m256i)n, (__m256i)n), 0x08));
+                        __builtin_memcpy(d_first, &packed, sizeof(packed));
+                    }
+
+                    inline void store_words(words n, void* d_first, std::int8_t)
+                    {
+                        auto const halves = _mm256_packs_epi32((__m256i)n, (__m256i)n);
+                        auto const packed = _mm256_permutevar8x32_epi32(
+                                _mm256_packs_epi16(halves, halves), _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+                        __builtin_memcpy(d_first, &packed, word_width);
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint8_t)
+                    {
+                        auto const halves = _mm256_packus_epi32((__m256i)n, (__m256i)n);
+                        auto const packed = _mm256_permutevar8x32_epi32(
+                                _mm256_packus_epi16(halves, halves), _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+                        __builtin_memcpy(d_first, &packed, word_width);
+                    }
+#else
+                    inline void store_words(words n, void* d_first, std::int16_t)
+                    {
+                        auto const packed = _mm_packs_epi32((__m128i)n, (__m128i)n);
+                        __builtin_memcpy(d_first, &packed, 2*word_width);
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint16_t)
+                    {
+                        auto const packed = _mm_packus_epi32((__m128i)n, (__m128i)n);
+                        __builtin_memcpy(d_first, &packed, 2*word_width);
+                    }
+
+                    inline void store_words(words n, void* d_first, std::int8_t)
+                    {
+                        auto const halves = _mm_packs_epi32((__m128i)n, (__m128i)n);
+                        auto const packed = _mm_packs_epi16(halves, halves);
+                        __builtin_memcpy(d_first, &packed, word_width);
+                    }
+
+                    inline void store_words(words n, void* d_first, std::uint8_t)
+                    {
+                        auto const halves = _mm_packus_epi32((__m128i)n, (__m128i)n);
+                        auto const packed = _mm_packus_epi16(halves, halves);
+                        __builtin_memcpy(d_first, &packed, word_width);
+                    }
+#endif
+
+                    template<class Rep, int Exponent, bool Saturate, bool Round>
+                    fixed_point<Rep, Exponent>* to_fixed(
+                            const float* first, const float* last, fixed_point<Rep, Exponent>* d_first)
+                    {
+                        using stored = set_digits_t<Rep, digits<Rep>::value>;
+                        auto const one = type::pow2<float, -Exponent>();
+                        for (; last-first>=word_width; first += word_width, d_first += word_width) {
+                            auto x = slanes{};
+                            __builtin_memcpy(&x, first, sizeof(x));
+                            auto const y = integral(x*one, std::integral_constant<bool, Round>{});
+                            store_words(integral_to_words<Rep, Saturate>(y), static_cast<void*>(d_first), stored{});
+                        }
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = batch::to_fixed<Rep, Exponent, Saturate, Round>(*first);
+                        }
+                        return d_first;
+                    }
+
+                    template<class Rep, int Exponent, bool Saturate, bool Round>
+                    fixed_point<Rep, Exponent>* to_fixed(
+                            const double* first, const double* last, fixed_point<Rep, Exponent>* d_first)
+                    {
+                        using stored = set_digits_t<Rep, digits<Rep>::value>;
+                        auto const one = type::pow2<double, -Exponent>();
+                        for (; last-first>=word_width; first += word_width, d_first += word_width) {
+                            auto low = dlanes{};
+                            auto high = dlanes{};
+                            __builtin_memcpy(&low, first, sizeof(low));
+                            __builtin_memcpy(&high, first+word_width/2, sizeof(high));
+                            low = integral(low*one, std::integral_constant<bool, Round>{});
+                            high = integral(high*one, std::integral_constant<bool, Round>{});
+                            store_words(integral_to_words<Rep, Saturate>(low, high), static_cast<void*>(d_first),
+                                    stored{});
+                        }
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = batch::to_fixed<Rep, Exponent, Saturate, Round>(*first);
+                        }
+                        return d_first;
+                    }
+
+                    // word_width values of up to 32 bits, sign- or zero-extended to 32-bit lanes
+                    inline words widen_to_words(const void* first, std::int8_t)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(cvtepi8_epi32)(load_low(first, word_width));
+                    }
+
+                    inline words widen_to_words(const void* first, std::uint8_t)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(cvtepu8_epi32)(load_low(first, word_width));
+                    }
+
+#if (SG14_LANES_BYTES==64)
+                    inline words widen_to_words(const void* first, std::int16_t)
+                    {
+                        return (words)_mm512_cvtepi16_epi32(_mm256_loadu_si256(static_cast<const __m256i*>(first)));
+                    }
+
+                    inline words widen_to_words(const void* first, std::uint16_t)
+                    {
+                        return (words)_mm512_cvtepu16_epi32(_mm256_loadu_si256(static_cast<const __m256i*>(first)));
+                    }
+#else
+                    inline words widen_to_words(const void* first, std::int16_t)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(cvtepi16_epi32)(load_low(first, 2*word_width));
+                    }
+
+                    inline words widen_to_words(const void* first, std::uint16_t)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(cvtepu16_epi32)(load_low(first, 2*word_width));
+                    }
+#endif
+
+                    inline words widen_to_words(const void* first, std::int32_t)
+                    {
+                        auto n = words{};
+                        __builtin_memcpy(&n, first, sizeof(n));
+                        return n;
+                    }
+
+                    inline words widen_to_words(const void* first, std::uint32_t)
+                    {
+                        return widen_to_words(first, std::int32_t{});
+                    }
+
+                    // the values of Rep in n, converted to single precision with a single rounding
+                    template<class Rep>
+                    slanes words_to_singles(words n)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        return (digits<Rep>::value==32)
+                               ? _mm512_cvtepu32_ps((__m512i)n)
+                               : _mm512_cvtepi32_ps((__m512i)n);
+#else
+                        // the upper and lower halves of a uint32_t are exact and so is their sum before rounding
+                        return (digits<Rep>::value==32)
+                               ? SG14_LANES_INTRINSIC(cvtepi32_ps)((integer_register)((uwords)n >> 16))*65536.f
+                                 +SG14_LANES_INTRINSIC(cvtepi32_ps)((integer_register)(n & 0xffff))
+                               : SG14_LANES_INTRINSIC(cvtepi32_ps)((integer_register)n);
+#endif
+                    }
+
+                    // the values of Rep in the low and high halves of n, converted to double precision exactly
+                    inline dlanes low_words_to_doubles(words n)
+                    {
+#if (SG14_LANES_BYTES==16)
+                        return _mm_cvtepi32_pd((__m128i)n);
+#elif (SG14_LANES_BYTES==32)
+                        return _mm256_cvtepi32_pd(_mm256_castsi256_si128((__m256i)n));
+#else
+                        return _mm512_cvtepi32_pd(_mm512_castsi512_si256((__m512i)n));
+#endif
+                    }
+
+                    inline dlanes high_words_to_doubles(words n)
+                    {
+#if (SG14_LANES_BYTES==16)
+                        return _mm_cvtepi32_pd(_mm_unpackhi_epi64((__m128i)n, (__m128i)n));
+#elif (SG14_LANES_BYTES==32)
+                        return _mm256_cvtepi32_pd(_mm256_extracti128_si256((__m256i)n, 1));
+#else
+                        return _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64((__m512i)n, 1));
+#endif
+                    }
+
+                    template<class Rep, int Exponent>
+                    float* to_float(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            float* d_first)
+                    {
+                        using stored = set_digits_t<Rep, digits<Rep>::value>;
+                        auto const inverse_one = type::pow2<float, Exponent>();
+                        for (; last-first>=word_width; first += word_width, d_first += word_width) {
+                            auto const x = words_to_singles<Rep>(widen_to_words(static_cast<const void*>(first), stored{}))
+                                           *inverse_one;
+                            __builtin_memcpy(d_first, &x, sizeof(x));
+                        }
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = static_cast<float>(*first);
+                        }
+                        return d_first;
+                    }
+
+                    template<class Rep, int Exponent>
+                    double* to_float(const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+                            double* d_first)
+                    {
+                        using stored = set_digits_t<Rep, digits<Rep>::value>;
+                        auto const inverse_one = type::pow2<double, Exponent>();
+
+                        // values of uint32_t are offset into the range of int32_t
+                        auto const offset = (digits<Rep>::value==32) ? std::numeric_limits<std::int32_t>::min() : 0;
+                        auto const double_offset = (digits<Rep>::value==32) ? type::pow2<double, 31>() : 0.;
+
+                        for (; last-first>=word_width; first += word_width, d_first += word_width) {
+                            auto const n = widen_to_words(static_cast<const void*>(first), stored{}) ^ offset;
+                            auto const low = (low_words_to_doubles(n)+double_offset)*inverse_one;
+                            auto const high = (high_words_to_doubles(n)+double_offset)*inverse_one;
+                            __builtin_memcpy(d_first, &low, sizeof(low));
+                            __builtin_memcpy(d_first+word_width/2, &high, sizeof(high));
+                        }
+                        for (; first!=last; ++first, ++d_first) {
+                            *d_first = static_cast<double>(*first);
+                        }
+                        return d_first;
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // saturating arithmetic of 8- and 16-bit values
+
+                    template<int Exponent>
+                    integer_register operate(_impl::add_op, integer_register lhs, integer_register rhs, std::int8_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(adds_epi8)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::add_op, integer_register lhs, integer_register rhs, std::uint8_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(adds_epu8)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::add_op, integer_register lhs, integer_register rhs, std::int16_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(adds_epi16)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::add_op, integer_register lhs, integer_register rhs, std::uint16_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(adds_epu16)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::subtract_op, integer_register lhs, integer_register rhs, std::int8_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(subs_epi8)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::subtract_op, integer_register lhs, integer_register rhs, std::uint8_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(subs_epu8)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::subtract_op, integer_register lhs, integer_register rhs, std::int16_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(subs_epi16)(lhs, rhs);
+                    }
+
+                    template<int Exponent>
+                    integer_register operate(_impl::subtract_op, integer_register lhs, integer_register rhs,
+                            std::uint16_t)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(subs_epu16)(lhs, rhs);
+                    }
+
+                    // divides by 2^Shift, rounding toward zero like the conversion of a scalar product
+                    template<int Shift>
+                    integer_register divide_halves(integer_register x)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(srai_epi16)(SG14_LANES_INTRINSIC(add_epi16)(x,
+                                SG14_LANES_INTRINSIC(srli_epi16)(SG14_LANES_INTRINSIC(srai_epi16)(x, 15), 16-Shift)),
+                                Shift);
+                    }
+
+                    template<int Shift>
+                    integer_register divide_words(integer_register x)
+                    {
+                        return (integer_register)SG14_LANES_INTRINSIC(srai_epi32)(SG14_LANES_INTRINSIC(add_epi32)(x,
+                                SG14_LANES_INTRINSIC(srli_epi32)(SG14_LANES_INTRINSIC(srai_epi32)(x, 31), 32-Shift)),
+                                Shift);
+                    }
+
+                    // the products of the even and odd bytes in 16-bit lanes, divided and saturated to 8 bits
+                    template<int Exponent>
+                    integer_register operate(_impl::multiply_op, integer_register lhs, integer_register rhs,
+                            std::int8_t)
+                    {
+                        auto const even = divide_halves<-Exponent>((integer_register)SG14_LANES_INTRINSIC(mullo_epi16)(
+                                SG14_LANES_INTRINSIC(srai_epi16)(SG14_LANES_INTRINSIC(slli_epi16)(lhs, 8), 8),
+                                SG14_LANES_INTRINSIC(srai_epi16)(SG14_LANES_INTRINSIC(slli_epi16)(rhs, 8), 8)));
+                        auto const odd = divide_halves<-Exponent>((integer_register)SG14_LANES_INTRINSIC(mullo_epi16)(
+                                SG14_LANES_INTRINSIC(srai_epi16)(lhs, 8),
+                                SG14_LANES_INTRINSIC(srai_epi16)(rhs, 8)));
+
+                        auto const lowest = SG14_LANES_INTRINSIC(set1_epi16)(-128);
+                        auto const max = SG14_LANES_INTRINSIC(set1_epi16)(127);
+                        auto const saturated_even = SG14_LANES_INTRINSIC(min_epi16)(
+                                SG14_LANES_INTRINSIC(max_epi16)(even, lowest), max);
+                        auto const saturated_odd = SG14_LANES_INTRINSIC(min_epi16)(
+                                SG14_LANES_INTRINSIC(max_epi16)(odd, lowest), max);
+                        return ((integer_register)saturated_even & (integer_register)SG14_LANES_INTRINSIC(set1_epi16)(0xff))
+                               | (integer_register)SG14_LANES_INTRINSIC(slli_epi16)(saturated_odd, 8);
+                    }
+
+                    // the 32-bit products of 16-bit values, divided and packed with saturation
+                    template<int Exponent>
+                    integer_register operate(_impl::multiply_op, integer_register lhs, integer_register rhs,
+                            std::int16_t)
+                    {
+                        auto const low = SG14_LANES_INTRINSIC(mullo_epi16)(lhs, rhs);
+                        auto const high = SG14_LANES_INTRINSIC(mulhi_epi16)(lhs, rhs);
+                        return (integer_register)SG14_LANES_INTRINSIC(packs_epi32)(
+                                divide_words<-Exponent>((integer_register)SG14_LANES_INTRINSIC(unpacklo_epi16)(low, high)),
+                                divide_words<-Exponent>((integer_register)SG14_LANES_INTRINSIC(unpackhi_epi16)(low, high)));
+                    }
+
+                    // the rounded product of Q15 values with the product of -1 and -1 saturated
+                    template<int Exponent>
+                    integer_register operate(q_mul_round_op, integer_register lhs, integer_register rhs, std::int16_t)
+                    {
+                        typedef std::int16_t halves __attribute__((vector_size(SG14_LANES_BYTES)));
+                        auto const product = (halves)SG14_LANES_INTRINSIC(mulhrs_epi16)(lhs, rhs);
+                        return (integer_register)(product ^ (product==std::numeric_limits<std::int16_t>::min()));
+                    }
+
+                    // the rounded product of Q31 values from the 64-bit products of the even and odd words
+                    template<int Exponent>
+                    integer_register operate(q_mul_round_op, integer_register lhs, integer_register rhs, std::int32_t)
+                    {
+                        auto const half = integer_register{}+(1LL << 30);
+                        auto const even = SG14_LANES_INTRINSIC(mul_epi32)(lhs, rhs)+half;
+                        auto const odd = SG14_LANES_INTRINSIC(mul_epi32)(
+                                SG14_LANES_INTRINSIC(srli_epi64)(lhs, 32), SG14_LANES_INTRINSIC(srli_epi64)(rhs, 32))+half;
+                        auto const low = integer_register{}+0xffffffffLL;
+                        auto const product = (words)((SG14_LANES_INTRINSIC(srli_epi64)(even, 31) & low)
+                                                     | (SG14_LANES_INTRINSIC(slli_epi64)(odd, 1) & ~low));
+                        return (integer_register)(product ^ (product==std::numeric_limits<std::int32_t>::min()));
+                    }
+
+                    // applies Operator to corresponding values of two ranges, a register at a time
+                    template<class Operator, class Rep, int Exponent>
+                    fixed_point<Rep, Exponent>* transform(
+                            const fixed_point<Rep, Exponent>* first1, const fixed_point<Rep, Exponent>* last1,
+                            const fixed_point<Rep, Exponent>* first2, fixed_point<Rep, Exponent>* d_first)
+                    {
+                        using underlying = typename std::decay<decltype(_impl::to_rep(std::declval<Rep>()))>::type;
+                        constexpr auto n = static_cast<int>(SG14_LANES_BYTES/sizeof(underlying));
+                        for (; last1-first1>=n; first1 += n, first2 += n, d_first += n) {
+                            auto lhs = integer_register{};
+                            auto rhs = integer_register{};
+                            __builtin_memcpy(&lhs, static_cast<const void*>(first1), sizeof(lhs));
+                            __builtin_memcpy(&rhs, static_cast<const void*>(first2), sizeof(rhs));
+                            auto const result = operate<Exponent>(Operator{}, lhs, rhs, underlying{});
+                            __builtin_memcpy(static_cast<void*>(d_first), &result, sizeof(result));
+                        }
+                        for (; first1!=last1; ++first1, ++first2, ++d_first) {
+                            *d_first = batch::operate<Operator>(*first1, *first2);
+                        }
+                        return d_first;
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // dot product of 16-bit values
+
+                    // pmaddwd only overflows where the products of two pairs of lowest values sum to 2^31;
+                    // subtracting one from each sum before sign extension leaves that sum in range
+                    inline integer_register low_words_to_quads(words n)
+                    {
+#if (SG14_LANES_BYTES==16)
+                        return (integer_register)_mm_cvtepi32_epi64((__m128i)n);
+#elif (SG14_LANES_BYTES==32)
+                        return (integer_register)_mm256_cvtepi32_epi64(_mm256_castsi256_si128((__m256i)n));
+#else
+                        return (integer_register)_mm512_cvtepi32_epi64(_mm512_castsi512_si256((__m512i)n));
+#endif
+                    }
+
+                    inline integer_register high_words_to_quads(words n)
+                    {
+#if (SG14_LANES_BYTES==16)
+                        return (integer_register)_mm_cvtepi32_epi64(_mm_unpackhi_epi64((__m128i)n, (__m128i)n));
+#elif (SG14_LANES_BYTES==32)
+                        return (integer_register)_mm256_cvtepi32_epi64(_mm256_extracti128_si256((__m256i)n, 1));
+#else
+                        return (integer_register)_mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64((__m512i)n, 1));
+#endif
+                    }
+
+                    template<class Lhs, class Rhs, class Accumulator>
+                    Accumulator dot(const Lhs* first1, const Lhs* last1, const Rhs* first2)
+                    {
+                        constexpr auto n = SG14_LANES_BYTES/2;
+                        auto sums = integer_register{};
+                        auto count = std::int64_t{0};
+                        for (; last1-first1>=n; first1 += n, first2 += n) {
+                            auto lhs = integer_register{};
+                            auto rhs = integer_register{};
+                            __builtin_memcpy(&lhs, static_cast<const void*>(first1), sizeof(lhs));
+                            __builtin_memcpy(&rhs, static_cast<const void*>(first2), sizeof(rhs));
+                            auto const pairs = (words)SG14_LANES_INTRINSIC(madd_epi16)(lhs, rhs)-1;
+                            sums += low_words_to_quads(pairs)+high_words_to_quads(pairs);
+                            count += n/2;
+                        }
+
+                        auto sum = count;
+                        for (auto lane = 0; lane!=SG14_LANES_BYTES/8; ++lane) {
+                            sum += sums[lane];
+                        }
+                        for (; first1!=last1; ++first1, ++first2) {
+                            sum += std::int64_t{first1->data()}*first2->data();
+                        }
+                        return static_cast<Accumulator>(sum);
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // biquad filter sections; each lane holds the state of one channel
+
+                    // signed product of the low 32 bits of each lane
+                    inline lanes multiply_signed_low32(lanes lhs, lanes rhs)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(mul_epi32)((integer_register)lhs, (integer_register)rhs);
+                    }
+
+                    // the state of width channels is held in registers while their frames are filtered
+                    template<class Coeff, class Sample, class State, std::size_t Sections, int FeedbackOrder>
+                    void biquad(
+                            const Coeff* coefficients, State* state, std::size_t channels,
+                            const Sample* first, const Sample* last, Sample* d_first)
+                    {
+                        using key = biquad_key<Coeff, Sample, State, Sections, FeedbackOrder>;
+                        constexpr auto state_count = key::state_count;
+                        auto const frames = static_cast<std::size_t>(last-first)/channels;
+                        auto const mask = broadcast((working_rep{1} << key::shift)-1);
+
+                        lanes c[Sections][key::coefficient_count];
+                        for (auto section = std::size_t{0}; section!=Sections; ++section) {
+                            for (auto k = 0; k!=key::coefficient_count; ++k) {
+                                c[section][k] = broadcast(working_rep{
+                                        coefficients[section*key::coefficient_count+k].data()});
+                            }
+                        }
+
+                        auto channel = std::size_t{0};
+                        for (; channels-channel>=width; channel += width) {
+                            // room for the largest state_count so that the unused rows need not be excluded
+                            lanes s[Sections][4];
+                            for (auto section = std::size_t{0}; section!=Sections; ++section) {
+                                for (auto k = 0; k!=state_count; ++k) {
+                                    __builtin_memcpy(&s[section][k], state+(section*state_count+k)*channels+channel,
+                                            sizeof(lanes));
+                                }
+                            }
+
+                            for (auto frame = std::size_t{0}; frame!=frames; ++frame) {
+                                auto x = load(first+frame*channels+channel);
+                                for (auto section = std::size_t{0}; section!=Sections; ++section) {
+                                    auto const& k = c[section];
+                                    auto& z = s[section];
+                                    auto accumulator = multiply_signed_low32(k[0], x)+z[0];
+                                    if (FeedbackOrder==1) {
+                                        accumulator += z[2];
+                                    }
+                                    if (FeedbackOrder==2) {
+                                        accumulator += 2*z[2]-z[3];
+                                        z[3] = z[2];
+                                    }
+                                    if (FeedbackOrder>=1) {
+                                        z[2] = accumulator & mask;
+                                    }
+                                    auto const y = saturate<typename Sample::rep>(accumulator >> key::shift);
+                                    z[0] = multiply_signed_low32(k[1], x)-multiply_signed_low32(k[3], y)+z[1];
+                                    z[1] = multiply_signed_low32(k[2], x)-multiply_signed_low32(k[4], y);
+                                    x = y;
+                                }
+                                store(x, d_first+frame*channels+channel);
+                            }
+
+                            for (auto section = std::size_t{0}; section!=Sections; ++section) {
+                                for (auto k = 0; k!=state_count; ++k) {
+                                    __builtin_memcpy(state+(section*state_count+k)*channels+channel, &s[section][k],
+                                            sizeof(lanes));
+                                }
+                            }
+                        }
+
+                        key::filter(coefficients, state, channels, channel, channels, first, last, d_first);
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // matrix multiplication; each 32-bit lane holds the sum of one element of a tile
+
+                    inline integer_register load_register(const void* first)
+                    {
+                        auto n = integer_register{};
+                        __builtin_memcpy(&n, first, sizeof(n));
+                        return n;
+                    }
+
+                    // as many tile rows as leave registers for a row of B and an element of A;
+                    // the loops are unrolled so that the sums are held in registers
+                    struct gemm_micro_kernel {
+                        static constexpr int vectors = 2;
+                        static constexpr int rows = (SG14_LANES_BYTES==64) ? 8 : 6;
+                        static constexpr int columns = vectors*word_width;
+
+                        static void apply(
+                                std::size_t pairs, const std::int32_t* a, const std::int32_t* b, std::int32_t* tile)
+                        {
+                            uwords sums[rows][vectors] = {};
+                            for (auto p = std::size_t{0}; p!=pairs; ++p, a += rows, b += columns) {
+                                integer_register rhs[vectors];
+#pragma GCC unroll 2
+                                for (auto v = 0; v!=vectors; ++v) {
+                                    rhs[v] = load_register(b+v*word_width);
+                                }
+#pragma GCC unroll 8
+                                for (auto r = 0; r!=rows; ++r) {
+                                    auto const lhs = (integer_register)(words{}+a[r]);
+#pragma GCC unroll 2
+                                    for (auto v = 0; v!=vectors; ++v) {
+                                        sums[r][v] += (uwords)SG14_LANES_INTRINSIC(madd_epi16)(lhs, rhs[v]);
+                                    }
+                                }
+                            }
+#pragma GCC unroll 8
+                            for (auto r = 0; r!=rows; ++r) {
+#pragma GCC unroll 2
+                                for (auto v = 0; v!=vectors; ++v) {
+                                    store_words((words)sums[r][v], tile+(r*vectors+v)*word_width, std::int32_t{});
+                                }
+                            }
+                        }
+                    };
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // radix-2 FFT butterflies; each 32-bit lane holds a complex value of 16-bit parts
+                    // and each 64-bit lane, one of 32-bit parts, the real part in the low half
+
+                    template<class Rep>
+                    struct complex_register;
+
+                    template<>
+                    struct complex_register<std::int16_t> {
+                        using type = words;
+                        using element = std::int32_t;
+                        static constexpr int size = word_width;
+                    };
+
+                    template<>
+                    struct complex_register<std::int32_t> {
+                        using type = lanes;
+                        using element = std::int64_t;
+                        static constexpr int size = width;
+                    };
+
+                    // 0, 1, 2...
+                    template<class Vector, class Element>
+                    Vector iota()
+                    {
+                        auto n = Vector{};
+                        for (auto lane = 0; lane!=static_cast<int>(sizeof(Vector)/sizeof(Element)); ++lane) {
+                            n[lane] = static_cast<Element>(lane);
+                        }
+                        return n;
+                    }
+
+                    // the complex values at the given indices of first
+                    inline words gather(const void* first, words index)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        return (words)_mm512_i32gather_epi32((__m512i)index, first, 4);
+#elif (SG14_LANES_BYTES==32)
+                        return (words)_mm256_i32gather_epi32(static_cast<const int*>(first), (__m256i)index, 4);
+#else
+                        auto n = words{};
+                        for (auto lane = 0; lane!=word_width; ++lane) {
+                            __builtin_memcpy(&n[lane], static_cast<const std::int32_t*>(first)+index[lane],
+                                    sizeof(std::int32_t));
+                        }
+                        return n;
+#endif
+                    }
+
+                    inline lanes gather(const void* first, lanes index)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        return (lanes)_mm512_i64gather_epi64((__m512i)index, first, 8);
+#elif (SG14_LANES_BYTES==32)
+                        return (lanes)_mm256_i64gather_epi64(static_cast<const long long*>(first), (__m256i)index, 8);
+#else
+                        auto n = lanes{};
+                        for (auto lane = 0; lane!=width; ++lane) {
+                            __builtin_memcpy(&n[lane], static_cast<const std::int64_t*>(first)+index[lane],
+                                    sizeof(std::int64_t));
+                        }
+                        return n;
+#endif
+                    }
+
+                    // stores the complex values to the given indices of d_first
+                    inline void scatter(void* d_first, words index, words n)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        _mm512_i32scatter_epi32(d_first, (__m512i)index, (__m512i)n, 4);
+#else
+                        for (auto lane = 0; lane!=word_width; ++lane) {
+                            __builtin_memcpy(static_cast<std::int32_t*>(d_first)+index[lane], &n[lane],
+                                    sizeof(std::int32_t));
+                        }
+#endif
+                    }
+
+                    inline void scatter(void* d_first, lanes index, lanes n)
+                    {
+#if (SG14_LANES_BYTES==64)
+                        _mm512_i64scatter_epi64(d_first, (__m512i)index, (__m512i)n, 8);
+#else
+                        for (auto lane = 0; lane!=width; ++lane) {
+                            __builtin_memcpy(static_cast<std::int64_t*>(d_first)+index[lane], &n[lane],
+                                    sizeof(std::int64_t));
+                        }
+#endif
+                    }
+
+                    // the complex conjugate; as that of a scalar part, the negation of the lowest imaginary part
+                    // saturates: its complement is the maximum, to which one is not added
+                    inline words conjugate(words w)
+                    {
+                        auto const complement = (uwords)w ^ 0xffff0000u;
+                        return (words)(complement+((uwords)((complement >> 16)!=0x7fffu) & 0x10000u));
+                    }
+
+                    inline lanes conjugate(lanes w)
+                    {
+                        auto const complement = (ulanes)w ^ 0xffffffff00000000u;
+                        return (lanes)(complement+((ulanes)((complement >> 32)!=0x7fffffffu) & 0x100000000u));
+                    }
+
+                    // divides by 2^Shift, rounding toward zero like the conversion of a scalar product
+                    template<int Shift>
+                    lanes divide_lanes(lanes x)
+                    {
+                        return (x+((x >> 63) & ((working_rep{1} << Shift)-1))) >> Shift;
+                    }
+
+                    // w*x, as complex_product; pmaddwd sums the products of the parts of each lane,
+                    // the real part as xr*wr + xi*~wi + xi, where ~wi is -wi-1 and never overflows
+                    template<int Shift>
+                    words twiddle_product(words x, words w)
+                    {
+                        auto const real = (words)SG14_LANES_INTRINSIC(madd_epi16)(
+                                (integer_register)x, (integer_register)((uwords)w ^ 0xffff0000u))+(x >> 16);
+                        auto const imag = (words)SG14_LANES_INTRINSIC(madd_epi16)(
+                                (integer_register)x, (integer_register)(((uwords)w >> 16) | ((uwords)w << 16)));
+                        return (words)(((uwords)divide_words<Shift>((integer_register)real) & 0xffffu)
+                                       | ((uwords)divide_words<Shift>((integer_register)imag) << 16));
+                    }
+
+                    template<int Shift>
+                    lanes twiddle_product(lanes x, lanes w)
+                    {
+                        auto const xi = (lanes)((ulanes)x >> 32);
+                        auto const wi = (lanes)((ulanes)w >> 32);
+                        auto const real = multiply_signed_low32(x, w)-multiply_signed_low32(xi, wi);
+                        auto const imag = multiply_signed_low32(xi, w)+multiply_signed_low32(x, wi);
+                        return (lanes)(((ulanes)divide_lanes<Shift>(real) & 0xffffffffu)
+                                       | ((ulanes)divide_lanes<Shift>(imag) << 32));
+                    }
+
+                    // the sums and differences of the parts, which wrap as the conversion of scalar sums
+                    inline words sum_parts(words lhs, words rhs)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(add_epi16)((integer_register)lhs, (integer_register)rhs);
+                    }
+
+                    inline words difference_parts(words lhs, words rhs)
+                    {
+                        return (words)SG14_LANES_INTRINSIC(sub_epi16)((integer_register)lhs, (integer_register)rhs);
+                    }
+
+                    inline lanes sum_parts(lanes lhs, lanes rhs)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(add_epi32)((integer_register)lhs, (integer_register)rhs);
+                    }
+
+                    inline lanes difference_parts(lanes lhs, lanes rhs)
+                    {
+                        return (lanes)SG14_LANES_INTRINSIC(sub_epi32)((integer_register)lhs, (integer_register)rhs);
+                    }
+
+                    template<class Vector>
+                    Vector broadcast_complex(const void* first)
+                    {
+                        auto n = typename std::decay<decltype(Vector{}[0])>::type{};
+                        __builtin_memcpy(&n, first, sizeof(n));
+                        return Vector{}+n;
+                    }
+
+                    // where the butterflies of a pass share a twiddle factor in runs of at least a register,
+                    // each run is processed a register at a time; otherwise a register of butterflies
+                    // with consecutive outputs is gathered
+                    template<class Rep, int Exponent>
+                    void stockham_pass(
+                            const std::complex<fixed_point<Rep, Exponent>>* twiddles, std::size_t n, int q, bool inverse,
+                            const std::complex<fixed_point<Rep, Exponent>>* y, std::complex<fixed_point<Rep, Exponent>>* x)
+                    {
+                        using vector = typename complex_register<Rep>::type;
+                        using element = typename complex_register<Rep>::element;
+                        constexpr auto size = complex_register<Rep>::size;
+                        constexpr auto shift = -Exponent;
+
+                        auto const half = n/2;
+                        if (half<size) {
+                            stockham_key<Rep, Exponent>::scalar(twiddles, n, q, inverse, y, x);
+                            return;
+                        }
+
+                        auto const r = n >> q;
+                        if (r>=size) {
+                            for (auto j = std::size_t{0}; j!=half/r; ++j) {
+                                auto w = broadcast_complex<vector>(twiddles+j*r);
+                                if (inverse) {
+                                    w = conjugate(w);
+                                }
+                                for (auto k = std::size_t{0}; k!=r; k += size) {
+                                    auto const a = (vector)load_register(y+2*j*r+k);
+                                    auto const tau = twiddle_product<shift>((vector)load_register(y+2*j*r+k+r), w);
+                                    auto const sum = sum_parts(a, tau);
+                                    auto const difference = difference_parts(a, tau);
+                                    __builtin_memcpy(static_cast<void*>(x+j*r+k), &sum, sizeof(sum));
+                                    __builtin_memcpy(static_cast<void*>(x+j*r+k+half), &difference, sizeof(difference));
+                                }
+                            }
+                            return;
+                        }
+
+                        // value e of the output is the sum of inputs 2*j*r+k and 2*j*r+k+r with twiddle factor j*r
+                        auto const group_mask = ~static_cast<element>(r-1);
+                        for (auto e = std::size_t{0}; e!=half; e += size) {
+                            auto const index = iota<vector, element>()+static_cast<element>(e);
+                            auto const group = index & group_mask;
+                            auto w = gather(twiddles, group);
+                            if (inverse) {
+                                w = conjugate(w);
+                            }
+                            auto const a = gather(y, index+group);
+                            auto const tau = twiddle_product<shift>(gather(y, index+group+static_cast<element>(r)), w);
+                            auto const sum = sum_parts(a, tau);
+                            auto const difference = difference_parts(a, tau);
+                            __builtin_memcpy(static_cast<void*>(x+e), &sum, sizeof(sum));
+                            __builtin_memcpy(static_cast<void*>(x+e+half), &difference, sizeof(difference));
+                        }
+                    }
+
+                    // where the butterflies of a stage have consecutive values in runs of at least a register,
+                    // each run is processed a register at a time with twiddle factors loaded or gathered;
+                    // otherwise a register of butterflies is gathered and scattered
+                    template<class Rep, int Exponent>
+                    void cooley_tukey_stage(
+                            const std::complex<fixed_point<Rep, Exponent>>* twiddles, std::size_t n, int q, bool inverse,
+                            std::size_t first, std::size_t last, std::complex<fixed_point<Rep, Exponent>>* data)
+                    {
+                        using vector = typename complex_register<Rep>::type;
+                        using element = typename complex_register<Rep>::element;
+                        constexpr auto size = complex_register<Rep>::size;
+                        constexpr auto shift = -Exponent;
+
+                        if (last-first<size) {
+                            cooley_tukey_key<Rep, Exponent>::scalar(twiddles, n, q, inverse, first, last, data);
+                            return;
+                        }
+
+                        auto const l = std::size_t{1} << q;
+                        auto const l_s = std::size_t{1} << (q-1);
+                        auto const r = n >> q;
+                        if (l_s>=size) {
+                            auto const block = butterflies(first, last, l_s);
+                            for (auto j = block.column_first; j!=block.column_last; j += size) {
+                                auto w = (r==1)
+                                         ? (vector)load_register(twiddles+j)
+                                         : gather(twiddles, (iota<vector, element>()+static_cast<element>(j))
+                                                            *static_cast<element>(r));
+                                if (inverse) {
+                                    w = conjugate(w);
+                                }
+                                for (auto k = block.row_first*l; k!=block.row_last*l; k += l) {
+                                    auto const a = (vector)load_register(data+k+j);
+                                    auto const tau = twiddle_product<shift>((vector)load_register(data+k+j+l_s), w);
+                                    auto const sum = sum_parts(a, tau);
+                                    auto const difference = difference_parts(a, tau);
+                                    __builtin_memcpy(static_cast<void*>(data+k+j), &sum, sizeof(sum));
+                                    __builtin_memcpy(static_cast<void*>(data+k+j+l_s), &difference, sizeof(difference));
+                                }
+                            }
+                            return;
+                        }
+
+                        // butterfly e combines values k*l+j and k*l+j+l_s, where e = k*l_s+j, with twiddle factor j*r
+                        auto const j_mask = static_cast<element>(l_s-1);
+                        for (auto e = first; e!=last; e += size) {
+                            auto const index = iota<vector, element>()+static_cast<element>(e);
+                            auto const j = index & j_mask;
+                            auto const a_index = index+(index & ~j_mask);
+                            auto const b_index = a_index+static_cast<element>(l_s);
+                            auto w = gather(twiddles, j*static_cast<element>(r));
+                            if (inverse) {
+                                w = conjugate(w);
+                            }
+                            auto const a = gather(data, a_index);
+                            auto const tau = twiddle_product<shift>(gather(data, b_index), w);
+                            scatter(data, a_index, sum_parts(a, tau));
+                            scatter(data, b_index, difference_parts(a, tau));
+                        }
+                    }
+
+                    ////////////////////////////////////////////////////////////////////////////////
+                    // entries of the dispatch tables
+
+                    template<class Operator, class Rep, int Exponent>
+                    constexpr typename arithmetic_key<Operator, Rep, Exponent>::function* entry(
+                            arithmetic_key<Operator, Rep, Exponent>)
+                    {
+                        return &transform<Operator, Rep, Exponent>;
+                    }
+
+                    template<class Lhs, class Rhs, class Accumulator>
+                    constexpr typename dot_key<Lhs, Rhs, Accumulator>::function* entry(dot_key<Lhs, Rhs, Accumulator>)
+                    {
+                        return &dot<Lhs, Rhs, Accumulator>;
+                    }
+
+                    template<class Coeff, class Sample, class State, std::size_t Sections, int FeedbackOrder>
+                    constexpr typename biquad_key<Coeff, Sample, State, Sections, FeedbackOrder>::function* entry(
+                            biquad_key<Coeff, Sample, State, Sections, FeedbackOrder>)
+                    {
+                        return &biquad<Coeff, Sample, State, Sections, FeedbackOrder>;
+                    }
+
+                    template<class Lhs, class Rhs>
+                    constexpr typename gemm_key<Lhs, Rhs>::function* entry(gemm_key<Lhs, Rhs>)
+                    {
+                        return &multiply_matrices<gemm_micro_kernel, Lhs, Rhs, typename gemm_key<Lhs, Rhs>::result_type>;
+                    }
+
+                    template<class Rep, int Exponent>
+                    constexpr typename stockham_key<Rep, Exponent>::function* entry(stockham_key<Rep, Exponent>)
+                    {
+                        return &stockham_pass<Rep, Exponent>;
+                    }
+
+                    template<class Rep, int Exponent>
+                    constexpr typename cooley_tukey_key<Rep, Exponent>::function* entry(cooley_tukey_key<Rep, Exponent>)
+                    {
+                        return &cooley_tukey_stage<Rep, Exponent>;
+                    }
+
+                    template<class Kernel, class Rep, int Exponent>
+                    constexpr typename transform_key<Kernel, Rep, Exponent>::function* entry(
+                            transform_key<Kernel, Rep, Exponent>)
+                    {
+                        return &transform<Kernel, Rep, Exponent>;
+                    }
+
+                    template<class Float, class Rep, int Exponent, bool Saturate, bool Round>
+                    constexpr typename to_fixed_key<Float, Rep, Exponent, Saturate, Round>::function* entry(
+                            to_fixed_key<Float, Rep, Exponent, Saturate, Round>)
+                    {
+                        return &to_fixed<Rep, Exponent, Saturate, Round>;
+                    }
+
+                    template<class Rep, int Exponent, class Float>
+                    constexpr typename to_float_key<Rep, Exponent, Float>::function* entry(
+                            to_float_key<Rep, Exponent, Float>)
+                    {
+                        return &to_float<Rep, Exponent>;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#undef SG14_LANES_INTRINSIC
+#undef SG14_LANES_NAMESPACE
+#undef SG14_LANES_BYTES
@@ -11,6 +11,7 @@
 #define FIXED_POINT_MATH_H_
 
 #include <sg14/fixed_point>
+#include "fixed_point_working.h"
 
 /// study group 14 of the C++ working group
 namespace sg14 {
@@ -21,12 +22,6 @@ namespace sg14 {
     namespace _impl {
         namespace fp {
 
-            template<class FixedPoint>
-            constexpr FixedPoint rounding_conversion(double d) {
-                using one_longer = make_fixed<FixedPoint::integer_digits, FixedPoint::fractional_digits + 1>;
-                return FixedPoint::from_data(static_cast<typename FixedPoint::rep>((one_longer{ d }.data() + 1) >> 1));
-            }
-
             template<class FixedPoint>
             using unsigned_rep = typename std::make_unsigned<typename FixedPoint::rep>::type;
 
@@ -35,53 +30,162 @@ namespace sg14 {
 
             static_assert(std::is_same<make_largest_ufraction<fixed_point<int32_t, -15>>, fixed_point<uint32_t, -32>>::value, "");
 
-            //TODO: template magic to get the coefficients automatically
-            //from the number of bits of precision
-            //Define the coefficients as constexpr,
-            //to make sure they're converted to fp
-            //at compile time
-            template<class CoeffType>
-            struct poly_coeffs {
-                static constexpr CoeffType a1 { rounding_conversion<CoeffType>(0.6931471860838825) };
-                static constexpr CoeffType a2 { rounding_conversion<CoeffType>(0.2402263846181129) };
-                static constexpr CoeffType a3 { rounding_conversion<CoeffType>(
-                        0.055505126858894846) };
-                static constexpr CoeffType a4 { rounding_conversion<CoeffType>(
-                        0.009614017013719252) };
-                static constexpr CoeffType a5 { rounding_conversion<CoeffType>(
-                        0.0013422634797558564) };
-                static constexpr CoeffType a6 { rounding_conversion<CoeffType>(
-                        0.00014352314226313836) };
-                static constexpr CoeffType a7 { rounding_conversion<CoeffType>(
-                        0.000021498763160402416) };
-            };
-
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a1;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a2;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a3;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a4;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a5;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a6;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a7;
+            //Converts a coefficient in Q64 to the fraction type in which a polynomial is evaluated, rounding to nearest
+            template<class Fraction>
+            constexpr Fraction coefficient(std::uint64_t q64) {
+                return Fraction::from_data(static_cast<typename Fraction::rep>((Fraction::fractional_digits<64)
+                        ? ((q64 >> ((Fraction::fractional_digits<64) ? 63-Fraction::fractional_digits : 0))+1) >> 1
+                        : q64));
+            }
+
+            //Computes x*(c[0] + x*(c[1] + ...)) for x and coefficients c in Q64 with 64-bit multiplications;
+            //the sum of the coefficients must be below 1
+            constexpr std::uint64_t horner_q64(std::uint64_t) {
+                return 0;
+            }
+
+            template<class... Tail>
+            constexpr std::uint64_t horner_q64(std::uint64_t x, std::uint64_t head, Tail... tail) {
+                return _impl::multiply_high(x, head+horner_q64(x, tail...));
+            }
+
+            //Saturates a sum in Q62 of 2^x, which the error of the polynomial may take to 2 near x = 1
+            constexpr working::working_rep exp2_q62_saturate(std::uint64_t sum) {
+                return static_cast<working::working_rep>(
+                        (sum>static_cast<std::uint64_t>(std::numeric_limits<working::working_rep>::max()))
+                        ? std::numeric_limits<working::working_rep>::max()
+                        : sum);
+            }
+
+            //1 + x*c[0] + x*(x*(c[1] + ...)) in Q62; c[0]+x*c[1]+... may exceed 1 near x = 1,
+            //so the first term is found apart from the rest, whose coefficients sum to below 1
+            template<class... Tail>
+            constexpr working::working_rep exp2_q62(std::uint64_t x, std::uint64_t head, Tail... tail) {
+                return exp2_q62_saturate((std::uint64_t{1} << 62)+(_impl::multiply_high(x, head) >> 2)
+                                         +(_impl::multiply_high(x, horner_q64(x, tail...)) >> 2));
+            }
+
+            //A minimax polynomial approximation of 2^x - 1 over [0, 1), whose absolute error is below 2^-Precision
+            template<int Precision, std::uint64_t... Coeffs>
+            struct exp2_polynomial {
+                static constexpr int precision = Precision;
+
+                //No constant term: the 1 is added by the caller
+                template<class Fraction>
+                static constexpr Fraction evaluate(Fraction x) {
+                    return polynomial<Fraction, 0, coefficient<Fraction>(Coeffs).data()...>::evaluate(x);
+                }
+
+                //2^x in Q62 for x in Q64, evaluated without multiplication wider than 64 bits
+                static constexpr working::working_rep evaluate_q62(std::uint64_t x) {
+                    return exp2_q62(x, Coeffs...);
+                }
+            };
+
+            //The family of exp2 polynomials, indexed by degree, with coefficients in Q64
+            template<int Degree>
+            struct exp2_coeffs;
+
+            template<>
+            struct exp2_coeffs<2> : exp2_polynomial<8,
+                    0xa94b6d9dfa4cda09, 0x55ef3801a8ce11ee> {
+            };
+
+            template<>
+            struct exp2_coeffs<3> : exp2_polynomial<12,
+                    0xb210039e34cdd6e2, 0x39e682e24c1cd8cb, 0x1401592aedfe9969> {
+            };
+
+            template<>
+            struct exp2_coeffs<4> : exp2_polynomial<17,
+                    0xb169a98fd323f291, 0x3dcf5f60133478d1, 0x0d4ca19689ac6af5, 0x037a0f873302ba29> {
+            };
+
+            template<>
+            struct exp2_coeffs<5> : exp2_polynomial<23,
+                    0xb17270bc1b58eb3f, 0x3d7aa786a7b300c5, 0x0e4b4367d55c6f7f, 0x024c144fdc9ce39f,
+                    0x007b8e0abebbfafe> {
+            };
+
+            template<>
+            struct exp2_coeffs<6> : exp2_polynomial<28,
+                    0xb1721500eda1a796, 0x3d7fb4e5bcc7d256, 0x0e3419a87aff4e4d, 0x027a7711d21e09ae,
+                    0x00515cc937152416, 0x000e488973e0c54d> {
+            };
+
+            template<>
+            struct exp2_coeffs<7> : exp2_polynomial<33,
+                    0xb172180d22a9620b, 0x3d7f79e458e31c4a, 0x0e35966121bac08d, 0x02760cf76ac94679,
+                    0x0057fd7ff691b006, 0x000963012b063a02, 0x00016a349284d86e> {
+            };
+
+            template<>
+            struct exp2_coeffs<8> : exp2_polynomial<39,
+                    0xb17217f74d9fdb9c, 0x3d7f7c0fa07179b5, 0x0e3583b52673a08f, 0x02765934cf5475af,
+                    0x005756f476c2428a, 0x000a2afec766ccf3, 0x0000edb8511fd115, 0x00001f638b923c98> {
+            };
+
+            template<>
+            struct exp2_coeffs<9> : exp2_polynomial<45,
+                    0xb17217f7d49fd32d, 0x3d7f7bfe9564504c, 0x0e35847184a886ae, 0x0276554599ff879b,
+                    0x00576298b338ca40, 0x000a16eb184c12c6, 0x000101ceb5073b5e, 0x00001495081f6e57,
+                    0x0000026aeea2931b> {
+            };
+
+            template<>
+            struct exp2_coeffs<10> : exp2_polynomial<51,
+                    0xb17217f7d1c1cd5b, 0x3d7f7bff08206d4f, 0x0e35846b5712c904, 0x0276556f5d5ba5da,
+                    0x005761f8f8c9525b, 0x000a185c154072b0, 0x0000ffc1942a7a6c, 0x0000165754476c24,
+                    0x0000019593fa1669, 0x0000002ae7397d93> {
+            };
+
+            template<>
+            struct exp2_coeffs<11> : exp2_polynomial<57,
+                    0xb17217f7d1cfb59c, 0x3d7f7bff057d9bcd, 0x0e35846b835f2658, 0x0276556decb7e669,
+                    0x005761ffdb7b9342, 0x000a1847b85aa0b4, 0x0000ffe8125a51ca, 0x00001628b9cd8219,
+                    0x000001b88ad96fab, 0x0000001c19aa11fd, 0x00000002b41a1801> {
+            };
+
+            template<>
+            struct exp2_coeffs<12> : exp2_polynomial<62,
+                    0xb17217f7d1cf78bd, 0x3d7f7bff058b5cb4, 0x0e35846b824a84de, 0x0276556df78f3721,
+                    0x005761ff9c47c6e3, 0x000a1848a012df15, 0x0000ffe5e5bdb2dc, 0x0000162c3309845f,
+                    0x000001b4e26ed96f, 0x0000001e8a1d8a42, 0x00000001c522fed8, 0x0000000027fa2ed5> {
+            };
+
+            template<>
+            struct exp2_coeffs<13> : exp2_polynomial<63,
+                    0xb17217f7d1cf79af, 0x3d7f7bff058b1c43, 0x0e35846b82507cc9, 0x0276556df7483ca5,
+                    0x005761ff9e3674c2, 0x000a1848977ff98a, 0x0000ffe5ff1b0cc5, 0x0000162bffd8f954,
+                    0x000001b5293046da, 0x0000001e48346f7e, 0x00000001ecb13739, 0x000000001a2aa379,
+                    0x000000000221ab2f> {
+            };
+
+            //The degree of the most precise exp2 polynomial; with coefficients in Q64,
+            //no polynomial has an error below 2^-63
+            constexpr int exp2_max_degree = 13;
+
+            //Selects the lowest degree exp2 polynomial whose error is below half the LSB
+            //of a fraction with the given number of digits; beyond 62 digits, none is that precise
+            //and the polynomial of exp2_max_degree is selected
+            template<int Digits, int Degree = 2,
+                    bool Sufficient = (exp2_coeffs<Degree>::precision>Digits || Degree==exp2_max_degree)>
+            struct exp2_select : exp2_select<Digits, Degree+1> {
+            };
+
+            template<int Digits, int Degree>
+            struct exp2_select<Digits, Degree, true> {
+                static constexpr int degree = Degree;
+                using type = exp2_coeffs<Degree>;
+            };
 
             template<class Rep, int Exponent>
             constexpr inline fixed_point<Rep, Exponent> evaluate_polynomial(
                     fixed_point<Rep, Exponent> xf) {
-                using fp = fixed_point<Rep, Exponent>;
-
                 //Use a polynomial min-max approximation to generate the exponential of
                 //the fractional part. Note that the constant 1 of the polynomial is added later,
                 //this gives us one more bit of precision here for free
-                using coeffs = poly_coeffs<fp>;
-                return fp{multiply(xf, (coeffs::a1+fp{multiply(xf, (coeffs::a2+fp{multiply(xf, (coeffs::a3+fp{multiply(xf, (coeffs::a4
-                        +fp{multiply(xf, (coeffs::a5+fp{multiply(xf, (coeffs::a6+fp{multiply(fp{coeffs::a7}, fp{xf})}))}))}))}))}))}))};
+                return exp2_select<-Exponent>::type::evaluate(xf);
             }
 
             //Computes 2^x - 1 for a number x between 0 and 1, strictly less than 1
@@ -109,9 +213,493 @@ namespace sg14 {
 
             template<class Rep, int Exponent>
             constexpr inline Rep floor(fixed_point<Rep, Exponent> x) {
-                return Rep { (x.data()) >> -Exponent };
+                return static_cast<Rep>((x.data()) >> -Exponent);
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // logarithm and exponential helpers
+            //
+            // Intermediate results are held in 64-bit integers with a few more fractional digits
+            // than the result so that the final rounding is the only significant error.
+
+            template<class Dummy = void>
+            struct log_coeffs {
+                // log2(e) in Q62
+                static constexpr working::uworking_rep log2_e = 0x5c551d94ae0bf85e;
+                // ln(2) in Q64
+                static constexpr working::uworking_rep ln_2 = 0xb17217f7d1cf79ac;
+                // log10(2) in Q64
+                static constexpr working::uworking_rep log10_2 = 0x4d104d427de7fbcc;
+            };
+
+            template<class Dummy>
+            constexpr working::uworking_rep log_coeffs<Dummy>::log2_e;
+            template<class Dummy>
+            constexpr working::uworking_rep log_coeffs<Dummy>::ln_2;
+            template<class Dummy>
+            constexpr working::uworking_rep log_coeffs<Dummy>::log10_2;
+
+            // number of fractional digits with which a logarithm is calculated before rounding;
+            // at most 56 so that log2 of any 64-bit value fits in a working_rep
+            constexpr int log_digits(int fractional_digits) {
+                return (fractional_digits<0) ? 8 : (fractional_digits>48) ? 56 : fractional_digits+8;
+            }
+
+            constexpr working::uworking_rep log2_digits(
+                    working::uworking_rep mantissa, int n, working::uworking_rep result);
+
+            constexpr working::uworking_rep log2_digits_squared(
+                    working::uworking_rep square, int n, working::uworking_rep result) {
+                return ((square >> 63)!=0)
+                       ? log2_digits(square, n, (result << 1) | 1)
+                       : log2_digits(square << 1, n, result << 1);
+            }
+
+            //Computes n fractional digits of log2(mantissa) for mantissa in [1, 2) in Q63.
+            //Squaring the mantissa doubles its logarithm, so each squaring yields the next digit.
+            constexpr working::uworking_rep log2_digits(
+                    working::uworking_rep mantissa, int n, working::uworking_rep result) {
+                return (n>0)
+                       ? log2_digits_squared(_impl::multiply_high(mantissa, mantissa), n-1, result)
+                       : result;
+            }
+
+            constexpr working::working_rep log2_normalized(
+                    working::uworking_rep magnitude, int used, int fractional_digits, int n) {
+                return working::working_rep{used-1-fractional_digits}*(working::working_rep{1} << n)
+                       +static_cast<working::working_rep>(log2_digits(magnitude << (64-used), n, 0));
+            }
+
+            //Computes log2(magnitude*2^-fractional_digits) with n fractional digits; magnitude must be non-zero
+            constexpr working::working_rep log2_working(
+                    working::uworking_rep magnitude, int fractional_digits, int n) {
+                return log2_normalized(magnitude, used_bits(magnitude), fractional_digits, n);
+            }
+
+            //Multiplies by a factor in [0, 1) in Q64
+            constexpr working::working_rep multiply_fraction(
+                    working::working_rep value, working::uworking_rep factor) {
+                return working::negate_if(value<0, static_cast<working::working_rep>(
+                        _impl::multiply_high(working::magnitude(value), factor)));
+            }
+
+            //Computes log2 of a raw value multiplied by factor in Q64;
+            //a factor of zero leaves the result unchanged
+            template<class Rep>
+            constexpr Rep log_rep(Rep rep, int fractional_digits, working::uworking_rep factor) {
+                using traits = working::rep_traits<Rep>;
+                return (traits::negative(rep) || traits::magnitude(rep)==0)
+                       ? working::saturate<Rep>(std::numeric_limits<working::working_rep>::min())
+                       : working::scale<Rep>(
+                               (factor==0)
+                               ? log2_working(traits::magnitude(rep), fractional_digits, log_digits(fractional_digits))
+                               : multiply_fraction(log2_working(
+                                       traits::magnitude(rep), fractional_digits, log_digits(fractional_digits)), factor),
+                               fractional_digits-log_digits(fractional_digits));
+            }
+
+            //The number of digits to which 2^x-1 is found for exp of a Rep: that of its width,
+            //as the result may use every digit of Rep
+            template<class Rep>
+            constexpr int exp_precision() {
+                return digits<Rep>::value+(is_signed<Rep>::value ? 1 : 0);
+            }
+
+            //Computes 2^(k+fraction) with the given number of fractional digits, where fraction is in Q64
+            //and 2^fraction-1 is found to Precision digits; k is clamped to a range beyond which every result saturates
+            template<class Rep, int Precision>
+            constexpr Rep exp2_split(working::working_rep k, working::uworking_rep fraction, int fractional_digits) {
+                return working::scale<Rep>(
+                        exp2_select<Precision>::type::evaluate_q62(fraction),
+                        static_cast<int>((k<-4096) ? -4096 : (k>4096) ? 4096 : k)+fractional_digits-62);
+            }
+
+            //y holds the exponent with y_digits (at most 61) fractional digits;
+            //when y_digits is negative, y is too large for the result to be anything but saturated
+            template<class Rep, int Precision>
+            constexpr Rep exp2_working(working::working_rep y, int y_digits, int fractional_digits) {
+                return (y_digits<0)
+                       ? exp2_split<Rep, Precision>((y==0) ? 0 : (y<0) ? -4096 : 4096, 0, fractional_digits)
+                       : exp2_split<Rep, Precision>(
+                               y >> y_digits,
+                               working::shift_left(
+                                       static_cast<working::uworking_rep>(y) & ((working::uworking_rep{1} << y_digits)-1),
+                                       64-y_digits),
+                               fractional_digits);
+            }
+
+            //product holds x*log2(e) with product_digits fractional digits
+            template<class Rep, int Precision = exp_precision<Rep>()>
+            constexpr Rep exp_product(working::working_rep product, int product_digits, int fractional_digits) {
+                return (product_digits>61)
+                       ? exp2_working<Rep, Precision>(
+                               product >> ((product_digits<124) ? product_digits-61 : 63), 61, fractional_digits)
+                       : exp2_working<Rep, Precision>(product, product_digits, fractional_digits);
+            }
+
+            template<class Rep>
+            constexpr Rep exp_rep(Rep rep, int fractional_digits) {
+                using traits = working::rep_traits<Rep>;
+                return exp_product<Rep>(
+                        working::negate_if(traits::negative(rep), static_cast<working::working_rep>(
+                                _impl::multiply_high(
+                                        traits::magnitude(rep) << ((digits<Rep>::value<63) ? 63-digits<Rep>::value : 0),
+                                        log_coeffs<>::log2_e))),
+                        fractional_digits+((digits<Rep>::value<63) ? 63-digits<Rep>::value : 0)-2,
+                        fractional_digits);
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // activation function helpers
+            //
+            // Each function is found from e^-a, where a is non-negative, so that the exponential,
+            // which is in (0, 1], never saturates and 1+e^-a can be inverted without a division.
+
+            //Computes e^-a in Q62 to 33 bits, where a = magnitude*2^-digits and magnitude is less than 2^63
+            constexpr working::working_rep exp_negative(working::uworking_rep magnitude, int digits) {
+                return exp_product<working::working_rep, 32>(
+                        -static_cast<working::working_rep>(_impl::multiply_high(
+                                magnitude << (63-working::used_bits(magnitude)), log_coeffs<>::log2_e)),
+                        digits+(63-working::used_bits(magnitude))-2,
+                        62);
+            }
+
+            //The magnitude of rep, capped below 2^63 as required by exp_negative;
+            //the cap only affects values whose exponential vanishes
+            template<class Rep>
+            constexpr working::uworking_rep activation_magnitude(Rep rep) {
+                return ((working::rep_traits<Rep>::magnitude(rep) >> 63)!=0)
+                       ? (working::uworking_rep{1} << 63)-1
+                       : working::rep_traits<Rep>::magnitude(rep);
+            }
+
+            //Number of Newton steps for the reciprocal of 1+e^-a;
+            //more are pointless as e^-a is only good to 33 bits
+            template<class Rep>
+            constexpr int activation_steps() {
+                return extras::reciprocal_steps((digits<Rep>::value<31) ? digits<Rep>::value+3 : 34);
+            }
+
+            //Computes 1/(1+e) in Q62 where e = e^-a in Q62, i.e. the logistic function of a;
+            //(1+e)/2 is in Q64, so e is capped below 1 to keep it less than 1
+            template<int Steps>
+            constexpr working::working_rep logistic_positive(working::working_rep e) {
+                return extras::reciprocal_normalized<Steps>(
+                        (static_cast<working::uworking_rep>((e<(working::working_rep{1} << 62)) ? e : (working::working_rep{1} << 62)-1)
+                         +(working::uworking_rep{1} << 62)) << 1);
+            }
+
+            //Computes the logistic function of a or -a in Q62 using 1/(1+e^a) = 1-1/(1+e^-a)
+            template<int Steps>
+            constexpr working::working_rep logistic(bool negative, working::working_rep e) {
+                return negative
+                       ? (working::working_rep{1} << 62)-logistic_positive<Steps>(e)
+                       : logistic_positive<Steps>(e);
+            }
+
+            template<class Rep>
+            constexpr Rep sigmoid_rep(Rep rep, int fractional_digits) {
+                return working::scale<Rep>(
+                        logistic<activation_steps<Rep>()>(
+                                working::rep_traits<Rep>::negative(rep),
+                                exp_negative(activation_magnitude(rep), fractional_digits)),
+                        fractional_digits-62);
+            }
+
+            //tanh(x) = 2/(1+e^-2x)-1 which, in Q61, is the logistic function of 2x in Q62 minus 2^61
+            template<class Rep>
+            constexpr Rep tanh_rep(Rep rep, int fractional_digits) {
+                return working::scale<Rep>(
+                        working::negate_if(
+                                working::rep_traits<Rep>::negative(rep),
+                                logistic<activation_steps<Rep>()>(
+                                        false,
+                                        exp_negative(activation_magnitude(rep), fractional_digits-1))
+                                -(working::working_rep{1} << 61)),
+                        fractional_digits-61);
+            }
+
+            //ln(1+e) with log_digits(fractional_digits) fractional digits where e = e^-a in Q62
+            constexpr working::working_rep log1p_exp_negative(working::working_rep e, int fractional_digits) {
+                return multiply_fraction(
+                        log2_working(
+                                (working::uworking_rep{1} << 62)+static_cast<working::uworking_rep>(e),
+                                62, log_digits(fractional_digits)),
+                        log_coeffs<>::ln_2);
+            }
+
+            //softplus(x) = max(x, 0)+ln(1+e^-|x|)
+            template<class Rep>
+            constexpr Rep softplus_rep(Rep rep, int fractional_digits) {
+                return working::rep_traits<Rep>::negative(rep)
+                       ? working::scale<Rep>(
+                               log1p_exp_negative(exp_negative(activation_magnitude(rep), fractional_digits), fractional_digits),
+                               fractional_digits-log_digits(fractional_digits))
+                       : working::saturate<Rep>(working::rep_traits<Rep>::magnitude(rep)+static_cast<working::uworking_rep>(
+                               working::scale<working::working_rep>(
+                                       log1p_exp_negative(exp_negative(activation_magnitude(rep), fractional_digits), fractional_digits),
+                                       fractional_digits-log_digits(fractional_digits))));
+            }
+
+            //Computes rep*s, rounded to nearest, where s is in Q62 and in [0, 1]
+            template<class Rep>
+            constexpr Rep multiply_q62(Rep rep, working::working_rep s) {
+                return (working::rep_traits<Rep>::magnitude(rep)==0)
+                       ? Rep{0}
+                       : working::scale<Rep>(
+                               working::negate_if(working::rep_traits<Rep>::negative(rep), static_cast<working::working_rep>(
+                                       _impl::multiply_high(
+                                               extras::normalize(working::rep_traits<Rep>::magnitude(rep)),
+                                               static_cast<working::uworking_rep>(s) << 1))),
+                               working::used_bits(working::rep_traits<Rep>::magnitude(rep))-63);
+            }
+
+            template<class Dummy = void>
+            struct gelu_coeffs {
+                // 0.044715 in Q64
+                static constexpr working::uworking_rep cubic = 0x0b727136a400fba9;
+                // 2*sqrt(2/pi) in Q63
+                static constexpr working::uworking_rep scale = 0xcc42299ea1b28468;
+            };
+
+            template<class Dummy>
+            constexpr working::uworking_rep gelu_coeffs<Dummy>::cubic;
+            template<class Dummy>
+            constexpr working::uworking_rep gelu_coeffs<Dummy>::scale;
+
+            //Computes 2*sqrt(2/pi)*(a+0.044715*a^3) in Q57 where a, in Q59, is less than 8;
+            //a^2 is in Q58 and a^3 is in Q55
+            constexpr working::uworking_rep gelu_argument(working::uworking_rep a) {
+                return _impl::multiply_high(
+                        ((a >> 4)+_impl::multiply_high(
+                                _impl::multiply_high(_impl::multiply_high(a << 2, a << 2), a << 2),
+                                gelu_coeffs<>::cubic)) << 3,
+                        gelu_coeffs<>::scale);
+            }
+
+            //|x| in Q59; beyond 8, the logistic function of the argument is within 2^-70 of 0 or 1
+            constexpr working::uworking_rep gelu_abscissa(working::uworking_rep magnitude, int fractional_digits) {
+                return (working::used_bits(magnitude)>fractional_digits+3)
+                       ? (working::uworking_rep{8} << 59)-1
+                       : working::shift_left(magnitude, 59-fractional_digits);
+            }
+
+            //gelu(x) = x/2*(1+tanh(u)) = x/(1+e^-2u) where u = sqrt(2/pi)*(x+0.044715*x^3)
+            template<class Rep>
+            constexpr Rep gelu_rep(Rep rep, int fractional_digits) {
+                return multiply_q62(rep, logistic<activation_steps<Rep>()>(
+                        working::rep_traits<Rep>::negative(rep),
+                        exp_negative(gelu_argument(gelu_abscissa(working::rep_traits<Rep>::magnitude(rep), fractional_digits)), 57)));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // power helpers
+
+            //Number of fractional digits of log2(x) which leave room in a working_rep
+            //for an integer part whose magnitude is at most 64+|fractional_digits|
+            constexpr int pow_log_digits(int fractional_digits) {
+                return 62-working::used_bits(static_cast<working::uworking_rep>(
+                        64+((fractional_digits<0) ? -fractional_digits : fractional_digits)));
+            }
+
+            //Left shift which moves the most significant bit of a magnitude to bit 62
+            constexpr int pow_justification(working::uworking_rep magnitude) {
+                return 63-working::used_bits(magnitude);
+            }
+
+            //Computes 2^(log*y) where the magnitudes of log and y are left-justified
+            //so that their product retains as many digits as possible
+            template<class Rep>
+            constexpr Rep pow_product(
+                    bool negative,
+                    working::uworking_rep log_magnitude, int log_digits,
+                    working::uworking_rep y_magnitude, int y_digits,
+                    int fractional_digits) {
+                return exp_product<Rep>(
+                        working::negate_if(negative, static_cast<working::working_rep>(_impl::multiply_high(
+                                log_magnitude << pow_justification(log_magnitude),
+                                y_magnitude << pow_justification(y_magnitude)))),
+                        log_digits+pow_justification(log_magnitude)+y_digits+pow_justification(y_magnitude)-64,
+                        fractional_digits);
+            }
+
+            template<class Rep, class YRep>
+            constexpr Rep pow_log(working::working_rep log, YRep y, int y_fractional_digits, int fractional_digits) {
+                return pow_product<Rep>(
+                        (log<0)!=working::rep_traits<YRep>::negative(y),
+                        working::magnitude(log), pow_log_digits(fractional_digits),
+                        working::rep_traits<YRep>::magnitude(y), y_fractional_digits,
+                        fractional_digits);
+            }
+
+            //Computes |x|^y for non-zero x
+            template<class Rep, class YRep>
+            constexpr Rep pow_magnitude(
+                    working::uworking_rep magnitude, YRep y, int y_fractional_digits, int fractional_digits) {
+                return pow_log<Rep>(
+                        log2_working(magnitude, fractional_digits, pow_log_digits(fractional_digits)),
+                        y, y_fractional_digits, fractional_digits);
+            }
+
+            //True if y is an odd integer
+            template<class YRep>
+            constexpr bool pow_odd(YRep y, int y_fractional_digits) {
+                return (y_fractional_digits>=0 && y_fractional_digits<64)
+                       && ((working::rep_traits<YRep>::magnitude(y) >> y_fractional_digits) & 1)!=0;
+            }
+
+            //True if y has no fractional part
+            template<class YRep>
+            constexpr bool pow_integral(YRep y, int y_fractional_digits) {
+                return y_fractional_digits<=0
+                       || ((y_fractional_digits<64)
+                           ? (working::rep_traits<YRep>::magnitude(y) << (64-y_fractional_digits))==0
+                           : working::rep_traits<YRep>::magnitude(y)==0);
+            }
+
+            //Zero raised to a negative power saturates;
+            //a negative x is raised to an integral power
+            template<class Rep, class YRep>
+            constexpr Rep pow_rep(Rep x, int fractional_digits, YRep y, int y_fractional_digits) {
+                return (working::rep_traits<Rep>::magnitude(x)==0)
+                       ? (working::rep_traits<YRep>::magnitude(y)==0)
+                         ? working::scale<Rep>(1, fractional_digits)
+                         : working::rep_traits<YRep>::negative(y)
+                           ? working::saturate<Rep>(std::numeric_limits<working::working_rep>::max())
+                           : Rep{0}
+                       : (working::rep_traits<Rep>::negative(x) && pow_odd(y, y_fractional_digits))
+                         ? static_cast<Rep>(-pow_magnitude<Rep>(
+                                 working::rep_traits<Rep>::magnitude(x), y, y_fractional_digits, fractional_digits))
+                         : pow_magnitude<Rep>(
+                                 working::rep_traits<Rep>::magnitude(x), y, y_fractional_digits, fractional_digits);
+            }
+
+            //A power with an integer exponent is carried as a mantissa, whose most significant bit is set,
+            //and a binary exponent such that its value is mantissa*2^exponent.
+            //The exponent is clamped to a range beyond which every result saturates or vanishes;
+            //this is safe because the powers of a base are monotonic in magnitude.
+            struct pow_working {
+                working::uworking_rep mantissa;
+                int exponent;
+            };
+
+            constexpr pow_working pow_one() {
+                return pow_working{working::uworking_rep{1} << 63, -63};
+            }
+
+            constexpr pow_working pow_clamp(working::uworking_rep mantissa, int exponent) {
+                return pow_working{mantissa, (exponent<-8192) ? -8192 : (exponent>8192) ? 8192 : exponent};
+            }
+
+            constexpr pow_working pow_normalize(working::uworking_rep mantissa, int exponent) {
+                return ((mantissa >> 63)!=0) ? pow_clamp(mantissa, exponent) : pow_clamp(mantissa << 1, exponent-1);
+            }
+
+            constexpr pow_working pow_from_magnitude(working::uworking_rep magnitude, int fractional_digits) {
+                return pow_working{
+                        magnitude << (64-working::used_bits(magnitude)),
+                        working::used_bits(magnitude)-64-fractional_digits};
+            }
+
+            constexpr pow_working pow_multiply(pow_working lhs, pow_working rhs) {
+                return pow_normalize(_impl::multiply_high(lhs.mantissa, rhs.mantissa), lhs.exponent+rhs.exponent+64);
             }
 
+            //Refines an estimate of 2^62/m, where m is the mantissa in Q64, with one Newton step
+            constexpr working::uworking_rep pow_reciprocal_step(working::uworking_rep mantissa, working::uworking_rep estimate) {
+                return _impl::multiply_high(estimate, (working::uworking_rep{2} << 62)-_impl::multiply_high(mantissa, estimate)) << 2;
+            }
+
+            //The 32-bit quotient which seeds the reciprocal is good to 31 bits
+            constexpr pow_working pow_reciprocal(pow_working power) {
+                return pow_normalize(
+                        pow_reciprocal_step(power.mantissa, (UINT64_MAX/((power.mantissa >> 32)+1)) << 30),
+                        -power.exponent-126);
+            }
+
+            constexpr pow_working pow_reciprocal_if(bool reciprocal, pow_working power) {
+                return reciprocal ? pow_reciprocal(power) : power;
+            }
+
+            //Computes result*base^n by square-and-multiply
+            constexpr pow_working pow_accumulate(pow_working base, unsigned long long n, pow_working result) {
+                return (n>1)
+                       ? pow_accumulate(pow_multiply(base, base), n >> 1, (n & 1) ? pow_multiply(result, base) : result)
+                       : (n==1) ? pow_multiply(result, base) : result;
+            }
+
+            //Computes base^n; the lowest set bit of n supplies the initial result
+            constexpr pow_working pow_unsigned(pow_working base, unsigned long long n) {
+                return (n & 1)
+                       ? (n>1) ? pow_accumulate(pow_multiply(base, base), n >> 1, base) : base
+                       : (n>1) ? pow_unsigned(pow_multiply(base, base), n >> 1) : pow_one();
+            }
+
+            //Computes base^N with the squares and products unrolled at compile time
+            template<unsigned long long N, bool Odd = (N & 1)!=0>
+            struct pow_unrolled {
+                static constexpr pow_working f(pow_working base) {
+                    return pow_unrolled<N/2>::f(pow_multiply(base, base));
+                }
+            };
+
+            template<unsigned long long N>
+            struct pow_unrolled<N, true> {
+                static constexpr pow_working f(pow_working base) {
+                    return pow_multiply(base, pow_unrolled<N/2>::f(pow_multiply(base, base)));
+                }
+            };
+
+            template<>
+            struct pow_unrolled<1, true> {
+                static constexpr pow_working f(pow_working base) {
+                    return base;
+                }
+            };
+
+            template<>
+            struct pow_unrolled<0, false> {
+                static constexpr pow_working f(pow_working) {
+                    return pow_one();
+                }
+            };
+
+            template<class Rep>
+            constexpr Rep pow_to_rep(bool negative, pow_working power, int fractional_digits) {
+                return working::scale<Rep>(
+                        working::negate_if(negative, static_cast<working::working_rep>(power.mantissa >> 1)),
+                        power.exponent+1+fractional_digits);
+            }
+
+            //Computes x^n for an integer, n, where the magnitude of n is given;
+            //zero raised to a negative power saturates
+            template<class Rep>
+            constexpr Rep pow_integer(
+                    Rep x, int fractional_digits, bool negative_n, unsigned long long magnitude_n) {
+                return (working::rep_traits<Rep>::magnitude(x)==0)
+                       ? (magnitude_n==0)
+                         ? working::scale<Rep>(1, fractional_digits)
+                         : negative_n
+                           ? working::saturate<Rep>(std::numeric_limits<working::working_rep>::max())
+                           : Rep{0}
+                       : pow_to_rep<Rep>(
+                               working::rep_traits<Rep>::negative(x) && (magnitude_n & 1),
+                               pow_reciprocal_if(negative_n, pow_unsigned(pow_from_magnitude(
+                                       working::rep_traits<Rep>::magnitude(x), fractional_digits), magnitude_n)),
+                               fractional_digits);
+            }
+
+            //As pow_integer with the power calculated by pow_unrolled<N>
+            template<class Rep, unsigned long long N>
+            constexpr Rep pow_unrolled_rep(Rep x, int fractional_digits, bool negative_n) {
+                return (working::rep_traits<Rep>::magnitude(x)==0)
+                       ? pow_integer<Rep>(x, fractional_digits, negative_n, N)
+                       : pow_to_rep<Rep>(
+                               working::rep_traits<Rep>::negative(x) && (N & 1),
+                               pow_reciprocal_if(negative_n, pow_unrolled<N>::f(pow_from_magnitude(
+                                       working::rep_traits<Rep>::magnitude(x), fractional_digits))),
+                               fractional_digits);
+            }
         }
     }
 
@@ -143,6 +731,245 @@ namespace sg14 {
                     + (Rep { 1 } << (floor(x) - Exponent))); //The constant term must be one, to make integer powers correct
     }
 
+    /// Calculates log2(x), the base-2 logarithm of x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range are saturated.
+    ///
+    /// \tparam x the input value as a fixed_point; must be positive
+    ///
+    /// \return the logarithm, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> log2(fixed_point<Rep, Exponent> x) {
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x<=fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot represent logarithm of non-positive value") :
+#endif
+                fixed_point<Rep, Exponent>::from_data(_impl::fp::log_rep(x.data(), -Exponent, 0));
+    }
+
+    /// Calculates log(x), the natural logarithm of x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range are saturated.
+    ///
+    /// \tparam x the input value as a fixed_point; must be positive
+    ///
+    /// \return the logarithm, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> log(fixed_point<Rep, Exponent> x) {
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x<=fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot represent logarithm of non-positive value") :
+#endif
+                fixed_point<Rep, Exponent>::from_data(
+                        _impl::fp::log_rep(x.data(), -Exponent, _impl::fp::log_coeffs<>::ln_2));
+    }
+
+    /// Calculates log10(x), the base-10 logarithm of x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range are saturated.
+    ///
+    /// \tparam x the input value as a fixed_point; must be positive
+    ///
+    /// \return the logarithm, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> log10(fixed_point<Rep, Exponent> x) {
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x<=fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot represent logarithm of non-positive value") :
+#endif
+                fixed_point<Rep, Exponent>::from_data(
+                        _impl::fp::log_rep(x.data(), -Exponent, _impl::fp::log_coeffs<>::log10_2));
+    }
+
+    /// Calculates exp(x), i.e. e^x, as exp2(x*log2(e))
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range are saturated.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the result of the exponential, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> exp(fixed_point<Rep, Exponent> x) {
+        //x*log2(e) is calculated with extra fractional digits
+        //so that 2^x is found to the precision of the result
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::exp_rep(x.data(), -Exponent));
+    }
+
+    /// Calculates pow(x, y), i.e. x^y, as exp2(y*log2(x))
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 2LSB for up to 32 bit underlying representation
+    /// where y*log2(x) is well within the range of the result;
+    /// otherwise the error grows with the magnitude of y.
+    /// Results which are out of range, including zero raised to a negative power, are saturated.
+    ///
+    /// \tparam x the base as a fixed_point; may be negative only if y is an integer
+    /// \tparam y the exponent as a fixed_point
+    ///
+    /// \return the power, in the same representation as x
+    ///
+    /// \sa exp2, log2
+    template<class Rep, int Exponent, class YRep, int YExponent>
+    constexpr fixed_point<Rep, Exponent> pow(fixed_point<Rep, Exponent> x, fixed_point<YRep, YExponent> y) {
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x<fixed_point<Rep, Exponent>(0) && !_impl::fp::pow_integral(y.data(), -YExponent))
+                ? throw std::invalid_argument("cannot represent power of negative value with non-integer exponent") :
+#endif
+                fixed_point<Rep, Exponent>::from_data(_impl::fp::pow_rep(x.data(), -Exponent, y.data(), -YExponent));
+    }
+
+    /// Calculates pow(x, n), i.e. x^n, for an integer exponent by square-and-multiply
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Intermediate powers are held as normalized 64-bit mantissas so that the result is rounded only once.
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range, including zero raised to a negative power, are saturated.
+    ///
+    /// \return the power, in the same representation as x
+    template<class Rep, int Exponent, class Integer, _impl::enable_if_t<std::is_integral<Integer>::value, int> dummy = 0>
+    constexpr fixed_point<Rep, Exponent> pow(fixed_point<Rep, Exponent> x, Integer n) {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::pow_integer(
+                x.data(), -Exponent, n<0,
+                (n<0) ? 0ull-static_cast<unsigned long long>(n) : static_cast<unsigned long long>(n)));
+    }
+
+    /// Calculates pow(x, n), i.e. x^n, for a \ref const_integer exponent
+    /// \headerfile sg14/fixed_point
+    ///
+    /// As pow(x, n) for an integer n but with the squares and products unrolled at compile time.
+    ///
+    /// \return the power, in the same representation as x
+    template<class Rep, int Exponent, class Integral, Integral Value, int Digits, int Zeros>
+    constexpr fixed_point<Rep, Exponent> pow(fixed_point<Rep, Exponent> x, const_integer<Integral, Value, Digits, Zeros>) {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::pow_unrolled_rep<
+                Rep, (Value<0) ? 0ull-static_cast<unsigned long long>(Value) : static_cast<unsigned long long>(Value)>(
+                x.data(), -Exponent, Value<0));
+    }
+
+    /// Calculates tanh(x), the hyperbolic tangent of x, as 2/(1+e^-2x)-1
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the hyperbolic tangent, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> tanh(fixed_point<Rep, Exponent> x) {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::tanh_rep(x.data(), -Exponent));
+    }
+
+    /// Calculates sigmoid(x), the logistic function 1/(1+e^-x)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// A result of 1 is saturated if x cannot represent it.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the logistic function of x, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> sigmoid(fixed_point<Rep, Exponent> x) {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::sigmoid_rep(x.data(), -Exponent));
+    }
+
+    /// Calculates softplus(x), i.e. log(1+e^x), as max(x, 0)+log(1+e^-|x|)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB for up to 32 bit underlying representation.
+    /// Results which are out of range are saturated.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the softplus function of x, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> softplus(fixed_point<Rep, Exponent> x) {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::softplus_rep(x.data(), -Exponent));
+    }
+
+    /// Calculates gelu(x), the Gaussian error linear unit, by its tanh approximation,
+    /// x/2*(1+tanh(sqrt(2/pi)*(x+0.044715*x^3)))
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Accurate to 1LSB of the approximation for up to 32 bit underlying representation.
+    /// The approximation differs from x*Phi(x), where Phi is the standard normal CDF, by less than 2^-11.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the approximate GELU of x, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> gelu(fixed_point<Rep, Exponent> x) {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::gelu_rep(x.data(), -Exponent));
+    }
+
+    /// Calculates tanh of each value in the contiguous range, [first, last)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>* tanh(
+            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first) {
+        for (; first!=last; ++first, ++d_first) {
+            *d_first = tanh(*first);
+        }
+        return d_first;
+    }
+
+    /// Calculates sigmoid of each value in the contiguous range, [first, last)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>* sigmoid(
+            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first) {
+        for (; first!=last; ++first, ++d_first) {
+            *d_first = sigmoid(*first);
+        }
+        return d_first;
+    }
+
+    /// Calculates softplus of each value in the contiguous range, [first, last)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>* softplus(
+            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first) {
+        for (; first!=last; ++first, ++d_first) {
+            *d_first = softplus(*first);
+        }
+        return d_first;
+    }
+
+    /// Calculates gelu of each value in the contiguous range, [first, last)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return end of the output range beginning at d_first, which may equal first
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent>* gelu(
+            const fixed_point<Rep, Exponent>* first, const fixed_point<Rep, Exponent>* last,
+            fixed_point<Rep, Exponent>* d_first) {
+        for (; first!=last; ++first, ++d_first) {
+            *d_first = gelu(*first);
+        }
+        return d_first;
+    }
+
 }
 
 #endif /* FIXED_POINT_MATH_H_ */
@@ -141,13 +141,32 @@ namespace sg14 {
     template<
             class LhsRep, int LhsExponent,
             class RhsInteger,
-            typename = _impl::enable_if_t<std::numeric_limits<RhsInteger>::is_integer>>
+            typename = _impl::enable_if_t<std::numeric_limits<RhsInteger>::is_integer
+                    && !is_const_integer<RhsInteger>::value>>
     constexpr auto operator/(const fixed_point<LhsRep, LhsExponent>& lhs, const RhsInteger& rhs)
     -> decltype(lhs/fixed_point<RhsInteger>{rhs})
     {
         return lhs/fixed_point<RhsInteger>{rhs};
     }
 
+    // fixed-point, const_integer -> fixed-point;
+    // the quotient of the rep, rounded toward zero and calculated without a divide instruction
+    template<class LhsRep, int LhsExponent, class RhsIntegral, RhsIntegral RhsValue, int RhsDigits, int RhsExponent>
+    constexpr fixed_point<LhsRep, LhsExponent>
+    operator/(const fixed_point<LhsRep, LhsExponent>& lhs, const_integer<RhsIntegral, RhsValue, RhsDigits, RhsExponent> rhs)
+    {
+        return fixed_point<LhsRep, LhsExponent>::from_data(_const_integer_impl::divide_integer(lhs.data(), rhs));
+    }
+
+    namespace _impl {
+        // keeps the generic number_base operators from converting a const_integer to fixed_point;
+        // a 64-bit rep would otherwise need a 128-bit quotient just to be considered
+        template<class Rep, int Exponent, class Integral, Integral Value, int Digits, int Zeros>
+        struct precedes<fixed_point<Rep, Exponent>, const_integer<Integral, Value, Digits, Zeros>> {
+            static constexpr bool value = false;
+        };
+    }
+
     // integer. fixed-point -> fixed-point
     template<
             class LhsInteger,
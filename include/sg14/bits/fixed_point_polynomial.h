@@ -0,0 +1,208 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief evaluation of polynomials with compile-time coefficients for the `sg14::fixed_point` type;
+/// included from sg14/fixed_point - do not include directly!
+
+#if !defined(SG14_FIXED_POINT_POLYNOMIAL_H)
+#define SG14_FIXED_POINT_POLYNOMIAL_H 1
+
+#include "fixed_point_named.h"
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // polynomial evaluation scheme tags and objects
+
+    // evaluate by nested multiplication; the default: fewest operations in one dependent chain
+    static constexpr struct horner_tag {
+    } horner{};
+
+    // evaluate pairs of terms independently and combine them with successive squares of x;
+    // more operations, but a dependent chain of logarithmic length
+    static constexpr struct estrin_tag {
+    } estrin{};
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // polynomial evaluation engine
+
+    namespace _impl {
+        namespace fp {
+            namespace poly {
+                // the Index'th value of a pack
+                template<int Index, class T, T... Values>
+                struct nth;
+
+                template<class T, T Head, T... Tail>
+                struct nth<0, T, Head, Tail...> {
+                    static constexpr T value = Head;
+                };
+
+                template<class T, T Head, T... Tail>
+                constexpr T nth<0, T, Head, Tail...>::value;
+
+                template<int Index, class T, T Head, T... Tail>
+                struct nth<Index, T, Head, Tail...> : nth<Index-1, T, Tail...> {
+                };
+
+                // converts a full-width product to Result, rounding to nearest
+                template<class Result, class Rep, int Exponent>
+                constexpr Result round_to(fixed_point<Rep, Exponent> const& product)
+                {
+                    return (Result::exponent<=Exponent)
+                           ? Result{product}
+                           : Result::from_data(static_cast<typename Result::rep>(
+                                   (product.data()+(Rep{1} << ((Result::exponent>Exponent) ? Result::exponent-Exponent-1 : 0)))
+                                   >> ((Result::exponent>Exponent) ? Result::exponent-Exponent : 0)));
+                }
+
+                // adds without the promotion of the built-in operator
+                template<class Coefficient>
+                constexpr Coefficient add(Coefficient const& lhs, Coefficient const& rhs)
+                {
+                    return Coefficient::from_data(static_cast<typename Coefficient::rep>(lhs.data()+rhs.data()));
+                }
+
+                template<class Coefficient, class X>
+                constexpr Coefficient multiply_add(Coefficient const& addend, X const& x, Coefficient const& factor)
+                {
+                    return add(addend, round_to<Coefficient>(multiply(x, factor)));
+                }
+
+                // x to the power of Power, which is a power of two, by repeated squaring
+                template<int Power>
+                struct power_of_two {
+                    template<class X>
+                    static constexpr X square(X const& y)
+                    {
+                        return round_to<X>(multiply(y, y));
+                    }
+
+                    template<class X>
+                    static constexpr X evaluate(X const& x)
+                    {
+                        return square(power_of_two<Power/2>::evaluate(x));
+                    }
+                };
+
+                template<>
+                struct power_of_two<1> {
+                    template<class X>
+                    static constexpr X evaluate(X const& x)
+                    {
+                        return x;
+                    }
+                };
+
+                // the largest power of two less than count
+                constexpr int estrin_split(int count, int split = 1)
+                {
+                    return (split*2<count) ? estrin_split(count, split*2) : split;
+                }
+
+                template<class Coefficient, typename Coefficient::rep... Values>
+                struct terms {
+                    template<int Index>
+                    static constexpr Coefficient coefficient()
+                    {
+                        return Coefficient::from_data(nth<Index, typename Coefficient::rep, Values...>::value);
+                    }
+
+                    // c[Begin] + x*(c[Begin+1] + x*(... + x*c[Begin+Count-1]))
+                    template<int Begin, int Count, class Enable = void>
+                    struct horner {
+                        template<class X>
+                        static constexpr Coefficient evaluate(X const& x)
+                        {
+                            return multiply_add(coefficient<Begin>(), x, horner<Begin+1, Count-1>::evaluate(x));
+                        }
+                    };
+
+                    template<int Begin, class Enable>
+                    struct horner<Begin, 1, Enable> {
+                        template<class X>
+                        static constexpr Coefficient evaluate(X const&)
+                        {
+                            return coefficient<Begin>();
+                        }
+                    };
+
+                    // low terms + x^Split * high terms, where Split is a power of two
+                    template<int Begin, int Count, class Enable = void>
+                    struct estrin {
+                        static constexpr int split = estrin_split(Count);
+
+                        template<class X>
+                        static constexpr Coefficient evaluate(X const& x)
+                        {
+                            return multiply_add(
+                                    estrin<Begin, split>::evaluate(x),
+                                    power_of_two<split>::evaluate(x),
+                                    estrin<Begin+split, Count-split>::evaluate(x));
+                        }
+                    };
+
+                    template<int Begin, class Enable>
+                    struct estrin<Begin, 1, Enable> {
+                        template<class X>
+                        static constexpr Coefficient evaluate(X const&)
+                        {
+                            return coefficient<Begin>();
+                        }
+                    };
+                };
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::polynomial
+
+    /// \brief a polynomial whose coefficients are known at compile time
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam Coefficient the \ref fixed_point type of the coefficients and of the result
+    /// \tparam Values the raw values of the coefficients in ascending order of power
+    ///
+    /// \note Each product is calculated at the full width of \ref multiply and rounded to
+    /// Coefficient (or, for the powers of x used by \ref estrin_tag, to the type of x) exactly once.
+    /// Sums are not checked, so Coefficient must have room for every partial sum.
+    ///
+    /// \sa horner_tag, estrin_tag
+    template<class Coefficient, typename Coefficient::rep... Values>
+    struct polynomial {
+        static_assert(sizeof...(Values)>0, "a polynomial needs at least one coefficient");
+
+        using coefficient_type = Coefficient;
+
+        /// the highest power of the polynomial
+        static constexpr int degree = sizeof...(Values)-1;
+
+        /// \brief evaluates the polynomial by Horner's scheme
+        template<class Rep, int Exponent>
+        static constexpr Coefficient evaluate(fixed_point<Rep, Exponent> const& x, horner_tag = horner)
+        {
+            return _terms::template horner<0, sizeof...(Values)>::evaluate(x);
+        }
+
+        /// \brief evaluates the polynomial by Estrin's scheme
+        template<class Rep, int Exponent>
+        static constexpr Coefficient evaluate(fixed_point<Rep, Exponent> const& x, estrin_tag)
+        {
+            return _terms::template estrin<0, sizeof...(Values)>::evaluate(x);
+        }
+
+    private:
+        using _terms = _impl::fp::poly::terms<Coefficient, Values...>;
+    };
+
+    template<class Coefficient, typename Coefficient::rep... Values>
+    constexpr int polynomial<Coefficient, Values...>::degree;
+}
+
+#endif	// SG14_FIXED_POINT_POLYNOMIAL_H
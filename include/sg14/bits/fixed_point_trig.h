@@ -0,0 +1,660 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief trigonometric functions for the `sg14::fixed_point` type;
+/// computed entirely with integer arithmetic using the CORDIC algorithm;
+/// included from sg14/fixed_point - do not include directly!
+
+#if !defined(SG14_FIXED_POINT_TRIG_H)
+#define SG14_FIXED_POINT_TRIG_H 1
+
+#include "fixed_point_working.h"
+
+#include <cmath>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // CORDIC engine
+
+    // https://en.wikipedia.org/wiki/CORDIC
+    namespace _impl {
+        namespace fp {
+            namespace trig {
+                using namespace working;
+
+                // all angles and coordinates are held in Q60 format
+                constexpr int working_fractional_digits = 60;
+
+                // one iteration resolves roughly one bit of the result
+                constexpr int max_iterations = working_fractional_digits;
+
+                template<class Dummy = void>
+                struct constants {
+                    // atan(2^-i) in Q60
+                    static constexpr working_rep atan[max_iterations+1] = {
+                            905502432259640355, 534549298976576474, 282441168888798124, 143371547418228444,
+                            71963988336308046, 36017075762092179, 18012932708689205, 9007016009513623,
+                            4503576721087964, 2251796950380271, 1125899548928887, 562949908682076,
+                            281474971118251, 140737487656277, 70368744090283, 35184372077909,
+                            17592186043051, 8796093022037, 4398046511083, 2199023255549,
+                            1099511627776, 549755813888, 274877906944, 137438953472,
+                            68719476736, 34359738368, 17179869184, 8589934592,
+                            4294967296, 2147483648, 1073741824, 536870912,
+                            268435456, 134217728, 67108864, 33554432,
+                            16777216, 8388608, 4194304, 2097152,
+                            1048576, 524288, 262144, 131072,
+                            65536, 32768, 16384, 8192,
+                            4096, 2048, 1024, 512,
+                            256, 128, 64, 32,
+                            16, 8, 4, 2,
+                            1
+                    };
+
+                    // reciprocal of the CORDIC gain in Q63
+                    static constexpr uworking_rep inverse_gain = 0x4dba76d421af2d34;
+
+                    // pi/2 in Q62
+                    static constexpr uworking_rep half_pi = 0x6487ed5110b4611a;
+
+                    // 2/pi in Q64
+                    static constexpr uworking_rep two_over_pi = 0xa2f9836e4e44152a;
+                };
+
+                template<class Dummy>
+                constexpr working_rep constants<Dummy>::atan[max_iterations+1];
+
+                template<class Dummy>
+                constexpr uworking_rep constants<Dummy>::inverse_gain;
+
+                template<class Dummy>
+                constexpr uworking_rep constants<Dummy>::half_pi;
+
+                template<class Dummy>
+                constexpr uworking_rep constants<Dummy>::two_over_pi;
+
+                constexpr working_rep one = working_rep{1} << working_fractional_digits;
+
+                constexpr working_rep pi = static_cast<working_rep>(constants<>::half_pi >> 1);
+
+                constexpr int iterations(int bits)
+                {
+                    return (bits<1) ? 1 : (bits>max_iterations) ? max_iterations : bits;
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // rotation and vectoring modes
+
+                struct state {
+                    working_rep x, y, z;
+                };
+
+                // rotates (x, y) through angle, z, driving z towards zero
+                constexpr state rotate(state s, int i, int n)
+                {
+                    return (i<n)
+                           ? rotate((s.z<0)
+                                    ? state{s.x+(s.y >> i), s.y-(s.x >> i), s.z+constants<>::atan[i]}
+                                    : state{s.x-(s.y >> i), s.y+(s.x >> i), s.z-constants<>::atan[i]},
+                                    i+1, n)
+                           : s;
+                }
+
+                // rotates (x, y) onto the x axis, accumulating the angle of rotation in z
+                constexpr state vectorize(state s, int i, int n)
+                {
+                    return (i<n)
+                           ? vectorize((s.y>0)
+                                       ? state{s.x+(s.y >> i), s.y-(s.x >> i), s.z+constants<>::atan[i]}
+                                       : state{s.x-(s.y >> i), s.y+(s.x >> i), s.z-constants<>::atan[i]},
+                                       i+1, n)
+                           : s;
+                }
+
+                // (cos(angle), sin(angle), residue) for angle in [0, pi/2]
+                constexpr state unit_vector(working_rep angle, int n)
+                {
+                    return rotate(state{static_cast<working_rep>((constants<>::inverse_gain+4) >> 3), 0, angle}, 0, n);
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // range reduction
+
+                struct reduced {
+                    int quadrant;
+                    working_rep angle;
+                };
+
+                // quarter_turns holds the angle in quarter turns with the given number of fractional digits
+                constexpr reduced reduce_quarter_turns(uworking_rep quarter_turns, int fractional_digits)
+                {
+                    return reduced{
+                            static_cast<int>(shift_left(quarter_turns, -fractional_digits) & 3),
+                            static_cast<working_rep>(_impl::multiply_high(
+                                    shift_left(quarter_turns, 64-fractional_digits),
+                                    constants<>::half_pi) >> 2)};
+                }
+
+                constexpr reduced reduce_normalized(uworking_rep angle, int fractional_digits, int shift)
+                {
+                    return reduce_quarter_turns(
+                            _impl::multiply_high(angle << shift, constants<>::two_over_pi),
+                            fractional_digits+shift);
+                }
+
+                // reduces a non-zero angle in radians to a quadrant and an angle in [0, pi/2)
+                constexpr reduced reduce(uworking_rep angle, int fractional_digits)
+                {
+                    return reduce_normalized(angle, fractional_digits, 64-used_bits(angle));
+                }
+
+                constexpr working_rep quadrant_sin(state s, int quadrant)
+                {
+                    return (quadrant==0) ? s.y : (quadrant==1) ? s.x : (quadrant==2) ? -s.y : -s.x;
+                }
+
+                constexpr working_rep reduced_sin(reduced r, int n)
+                {
+                    return quadrant_sin(unit_vector(r.angle, n), r.quadrant);
+                }
+
+                constexpr working_rep reduced_cos(reduced r, int n)
+                {
+                    return quadrant_sin(unit_vector(r.angle, n), (r.quadrant+1) & 3);
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // Q60 results
+
+                constexpr working_rep sin(bool negative, uworking_rep angle, int fractional_digits)
+                {
+                    return (angle==0)
+                           ? 0
+                           : negate_if(negative, reduced_sin(
+                                   reduce(angle, fractional_digits),
+                                   iterations(fractional_digits+3)));
+                }
+
+                constexpr working_rep cos(uworking_rep angle, int fractional_digits)
+                {
+                    return (angle==0)
+                           ? one
+                           : reduced_cos(reduce(angle, fractional_digits), iterations(fractional_digits+3));
+                }
+
+                constexpr working_rep first_quadrant_atan2(uworking_rep y, uworking_rep x, int shift, int n)
+                {
+                    return vectorize(state{
+                            static_cast<working_rep>(shift_left(x, shift)),
+                            static_cast<working_rep>(shift_left(y, shift)),
+                            0}, 0, n).z;
+                }
+
+                constexpr working_rep atan2(
+                        bool y_negative, uworking_rep y,
+                        bool x_negative, uworking_rep x,
+                        int fractional_digits)
+                {
+                    return (x==0 && y==0)
+                           ? 0
+                           : negate_if(y_negative, x_negative
+                                   ? pi-first_quadrant_atan2(
+                                           y, x,
+                                           working_fractional_digits-used_bits(x|y),
+                                           iterations(fractional_digits+3))
+                                   : first_quadrant_atan2(
+                                           y, x,
+                                           working_fractional_digits-used_bits(x|y),
+                                           iterations(fractional_digits+3)));
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // hypot
+
+                // scales the Q60-normalized magnitude back by the normalizing shift, rounding to nearest
+                constexpr uworking_rep denormalize(uworking_rep n, int shift)
+                {
+                    return (shift>0)
+                           ? (shift>=64) ? 0 : (n >> shift)+((n >> (shift-1)) & 1)
+                           : (-shift>=64 || n>(~uworking_rep{0} >> -shift)) ? ~uworking_rep{0} : n << -shift;
+                }
+
+                constexpr uworking_rep hypot_normalized(uworking_rep y, uworking_rep x, int shift, int n)
+                {
+                    return denormalize(_impl::multiply_high(
+                            static_cast<uworking_rep>(vectorize(state{
+                                    static_cast<working_rep>(shift_left(x, shift)),
+                                    static_cast<working_rep>(shift_left(y, shift)),
+                                    0}, 0, n).x) << 1,
+                            constants<>::inverse_gain), shift);
+                }
+
+                constexpr uworking_rep hypot(uworking_rep y, uworking_rep x, int digits)
+                {
+                    return (x==0 && y==0)
+                           ? 0
+                           : hypot_normalized(y, x, working_fractional_digits-used_bits(x|y), iterations(digits/2+3));
+                }
+
+                // converts a Q60 value to a Rep with the given number of fractional digits
+                template<class Rep>
+                constexpr Rep from_working(working_rep n, int fractional_digits)
+                {
+                    return scale<Rep>(n, fractional_digits-working_fractional_digits);
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // trigonometric backend tags and objects
+
+    // compute trigonometric functions by CORDIC iteration; the default
+    static constexpr struct cordic_trig_tag {
+    } cordic_trig{};
+
+    // interpolate linearly between adjacent table entries
+    static constexpr struct linear_interpolation_tag {
+    } linear_interpolation{};
+
+    // interpolate through three successive table entries
+    static constexpr struct quadratic_interpolation_tag {
+    } quadratic_interpolation{};
+
+    // look up trigonometric functions in a quarter-wave table of TableSize intervals
+    template<int TableSize = 256, class Interpolation = linear_interpolation_tag>
+    struct lookup_trig_tag {
+        static_assert(TableSize>=2 && TableSize<=65536 && (TableSize & (TableSize-1))==0,
+                "TableSize must be a power of two between 2 and 65536");
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // quarter-wave lookup table engine
+
+    namespace _impl {
+        namespace fp {
+            namespace trig {
+                template<std::size_t... Indices>
+                struct index_sequence {
+                };
+
+                template<class Lhs, class Rhs>
+                struct concat_index_sequence;
+
+                template<std::size_t... Lhs, std::size_t... Rhs>
+                struct concat_index_sequence<index_sequence<Lhs...>, index_sequence<Rhs...>> {
+                    using type = index_sequence<Lhs..., (sizeof...(Lhs)+Rhs)...>;
+                };
+
+                template<std::size_t N>
+                struct make_index_sequence {
+                    using type = typename concat_index_sequence<
+                            typename make_index_sequence<N/2>::type,
+                            typename make_index_sequence<N-N/2>::type>::type;
+                };
+
+                template<>
+                struct make_index_sequence<0> {
+                    using type = index_sequence<>;
+                };
+
+                template<>
+                struct make_index_sequence<1> {
+                    using type = index_sequence<0>;
+                };
+
+                // number of fractional digits in each table entry;
+                // a few more than the result type to leave room for interpolation
+                constexpr int table_entry_digits(int fractional_digits)
+                {
+                    return (fractional_digits<0) ? 8 : (fractional_digits>22) ? 30 : fractional_digits+8;
+                }
+
+                // angle of the i-th of table_size intervals in [0, pi/2) in Q60
+                constexpr working_rep table_angle(std::size_t i, int table_digits)
+                {
+                    return static_cast<working_rep>(_impl::multiply_high(
+                            static_cast<uworking_rep>(i) << (64-table_digits),
+                            constants<>::half_pi) >> 2);
+                }
+
+                // sin(i*pi/(2*table_size)) with entry_digits fractional digits;
+                // entries beyond pi/2 are needed by the interpolation
+                constexpr std::int32_t table_entry(std::size_t i, int table_digits, int entry_digits)
+                {
+                    return static_cast<std::int32_t>((reduced_sin(
+                            ((i >> table_digits)==0)
+                            ? reduced{0, table_angle(i, table_digits)}
+                            : reduced{1, table_angle(i-(std::size_t{1} << table_digits), table_digits)},
+                            max_iterations)+(working_rep{1} << (working_fractional_digits-entry_digits-1)))
+                            >> (working_fractional_digits-entry_digits));
+                }
+
+                template<int EntryDigits, int TableDigits,
+                        class Indices = typename make_index_sequence<(std::size_t{1} << TableDigits)+3>::type>
+                struct sine_table;
+
+                template<int EntryDigits, int TableDigits, std::size_t... Indices>
+                struct sine_table<EntryDigits, TableDigits, index_sequence<Indices...>> {
+                    static constexpr std::int32_t data[sizeof...(Indices)] = {
+                            table_entry(Indices, TableDigits, EntryDigits)...
+                    };
+                };
+
+                template<int EntryDigits, int TableDigits, std::size_t... Indices>
+                constexpr std::int32_t sine_table<EntryDigits, TableDigits, index_sequence<Indices...>>::data[
+                        sizeof...(Indices)];
+
+                // 1 in the Q32 format of interpolation weights and quarter-turn positions
+                constexpr working_rep unit_weight = working_rep{1} << 32;
+
+                constexpr working_rep interpolate(
+                        linear_interpolation_tag,
+                        working_rep y0, working_rep y1, working_rep, working_rep weight)
+                {
+                    return y0+(((y1-y0)*weight+(unit_weight >> 1)) >> 32);
+                }
+
+                // Newton's forward difference formula through entries i, i+1 and i+2
+                constexpr working_rep interpolate(
+                        quadratic_interpolation_tag,
+                        working_rep y0, working_rep y1, working_rep y2, working_rep weight)
+                {
+                    return y0+(((y1-y0)*weight
+                                +(y2-2*y1+y0)*((weight*(weight-unit_weight)) >> 33)
+                                +(unit_weight >> 1)) >> 32);
+                }
+
+                template<class Table, class Interpolation>
+                constexpr working_rep table_lookup(uworking_rep index, working_rep weight)
+                {
+                    return interpolate(
+                            Interpolation{},
+                            Table::data[index], Table::data[index+1], Table::data[index+2],
+                            weight);
+                }
+
+                template<class Rep, int Exponent, int TableSize, class Interpolation>
+                struct lookup {
+                    static_assert(digits<Rep>::value<=64, "the lookup backend supports reps of up to 64 bits");
+
+                    static constexpr int fractional_digits = -Exponent;
+                    static constexpr int entry_digits = table_entry_digits(fractional_digits);
+                    static constexpr int table_digits = used_bits(TableSize)-1;
+
+                    // normalizes the input ahead of multiplication by 2/pi
+                    static constexpr int shift = (digits<Rep>::value<63) ? 63-digits<Rep>::value : 0;
+
+                    using table = sine_table<entry_digits, table_digits>;
+
+                    // position in [0, 1] of a quarter turn in Q32
+                    static constexpr working_rep at(uworking_rep position)
+                    {
+                        return table_lookup<table, Interpolation>(
+                                position >> (32-table_digits),
+                                static_cast<working_rep>((position << table_digits) & UINT32_MAX));
+                    }
+
+                    static constexpr working_rep quadrant_sin(int quadrant, uworking_rep position)
+                    {
+                        return (quadrant==0) ? at(position)
+                                : (quadrant==1) ? at(unit_weight-position)
+                                : (quadrant==2) ? -at(position)
+                                : -at(unit_weight-position);
+                    }
+
+                    // quarter_turns holds the angle in quarter turns with fractional_digits+shift fractional digits
+                    static constexpr working_rep quarter_turns_sin(uworking_rep quarter_turns, int quadrant_offset)
+                    {
+                        return quadrant_sin(
+                                static_cast<int>((shift_left(quarter_turns, -(fractional_digits+shift))
+                                                  +quadrant_offset) & 3),
+                                shift_left(quarter_turns, 32-(fractional_digits+shift)) & UINT32_MAX);
+                    }
+
+                    static constexpr Rep sin(bool negative, uworking_rep magnitude, int quadrant_offset)
+                    {
+                        return scale<Rep>(negate_if(negative, quarter_turns_sin(
+                                _impl::multiply_high(magnitude << shift, constants<>::two_over_pi),
+                                quadrant_offset)), fractional_digits-entry_digits);
+                    }
+                };
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // CORDIC entry points
+
+    namespace _impl {
+        namespace fp {
+            namespace trig {
+                // reps with more digits than working_rep are not truncated to it
+                // but converted to and from floating-point instead
+                template<class Rep>
+                using wide = std::integral_constant<bool, (digits<Rep>::value>64)>;
+
+                template<class Rep, int Exponent>
+                fixed_point<Rep, Exponent> from_float(float_of_same_size<Rep> f) noexcept
+                {
+                    using result_type = fixed_point<Rep, Exponent>;
+                    using limits = std::numeric_limits<Rep>;
+                    return (f>=static_cast<float_of_same_size<Rep>>(result_type::from_data(limits::max())))
+                           ? result_type::from_data(limits::max())
+                           : (f<=static_cast<float_of_same_size<Rep>>(result_type::from_data(limits::lowest())))
+                             ? result_type::from_data(limits::lowest())
+                             : static_cast<result_type>(f);
+                }
+
+                template<class Rep, int Exponent>
+                constexpr fixed_point<Rep, Exponent> sin(const fixed_point<Rep, Exponent>& x, std::false_type) noexcept
+                {
+                    return fixed_point<Rep, Exponent>::from_data(from_working<Rep>(
+                            sin(rep_traits<Rep>::negative(x.data()), rep_traits<Rep>::magnitude(x.data()), -Exponent),
+                            -Exponent));
+                }
+
+                template<class Rep, int Exponent>
+                fixed_point<Rep, Exponent> sin(const fixed_point<Rep, Exponent>& x, std::true_type) noexcept
+                {
+                    return from_float<Rep, Exponent>(std::sin(static_cast<float_of_same_size<Rep>>(x)));
+                }
+
+                template<class Rep, int Exponent>
+                constexpr fixed_point<Rep, Exponent> cos(const fixed_point<Rep, Exponent>& x, std::false_type) noexcept
+                {
+                    return fixed_point<Rep, Exponent>::from_data(from_working<Rep>(
+                            cos(rep_traits<Rep>::magnitude(x.data()), -Exponent),
+                            -Exponent));
+                }
+
+                template<class Rep, int Exponent>
+                fixed_point<Rep, Exponent> cos(const fixed_point<Rep, Exponent>& x, std::true_type) noexcept
+                {
+                    return from_float<Rep, Exponent>(std::cos(static_cast<float_of_same_size<Rep>>(x)));
+                }
+
+                template<class Rep, int Exponent>
+                constexpr fixed_point<Rep, Exponent> atan2(
+                        const fixed_point<Rep, Exponent>& y, const fixed_point<Rep, Exponent>& x,
+                        std::false_type) noexcept
+                {
+                    return fixed_point<Rep, Exponent>::from_data(from_working<Rep>(
+                            atan2(
+                                    rep_traits<Rep>::negative(y.data()), rep_traits<Rep>::magnitude(y.data()),
+                                    rep_traits<Rep>::negative(x.data()), rep_traits<Rep>::magnitude(x.data()),
+                                    -Exponent),
+                            -Exponent));
+                }
+
+                template<class Rep, int Exponent>
+                fixed_point<Rep, Exponent> atan2(
+                        const fixed_point<Rep, Exponent>& y, const fixed_point<Rep, Exponent>& x,
+                        std::true_type) noexcept
+                {
+                    return from_float<Rep, Exponent>(std::atan2(
+                            static_cast<float_of_same_size<Rep>>(y), static_cast<float_of_same_size<Rep>>(x)));
+                }
+
+                template<class Rep, int Exponent>
+                constexpr fixed_point<Rep, Exponent> hypot(
+                        const fixed_point<Rep, Exponent>& x, const fixed_point<Rep, Exponent>& y,
+                        std::false_type) noexcept
+                {
+                    return fixed_point<Rep, Exponent>::from_data(saturate<Rep>(
+                            hypot(rep_traits<Rep>::magnitude(y.data()), rep_traits<Rep>::magnitude(x.data()),
+                                    digits<Rep>::value)));
+                }
+
+                template<class Rep, int Exponent>
+                fixed_point<Rep, Exponent> hypot(
+                        const fixed_point<Rep, Exponent>& x, const fixed_point<Rep, Exponent>& y,
+                        std::true_type) noexcept
+                {
+                    return from_float<Rep, Exponent>(std::hypot(
+                            static_cast<float_of_same_size<Rep>>(x), static_cast<float_of_same_size<Rep>>(y)));
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::sin
+
+    /// \brief calculates the sine of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x angle in radians
+    ///
+    /// \return sine of x, saturated to the range of the result type
+    ///
+    /// \note Uses integer-only CORDIC iteration; the result is accurate to 1 LSB
+    /// for representations of up to 32 bits.
+    /// Representations of more than 64 bits are converted to and from floating-point instead.
+    ///
+    /// \sa cos, atan2
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent>
+    sin(const fixed_point<Rep, Exponent>& x, cordic_trig_tag = cordic_trig) noexcept
+    {
+        return _impl::fp::trig::sin(x, _impl::fp::trig::wide<Rep>{});
+    }
+
+    /// \brief calculates the sine of a \ref fixed_point value using a quarter-wave lookup table
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x angle in radians
+    ///
+    /// \return sine of x, saturated to the range of the result type
+    ///
+    /// \note The table is generated at compile time from the fractional digits of x.
+    /// With h = pi/(2*TableSize), interpolation error is at most h*h/8 for linear interpolation
+    /// and h*h*h/15 for quadratic interpolation, plus half an LSB of rounding.
+    ///
+    /// \sa cos, lookup_trig_tag
+    template<class Rep, int Exponent, int TableSize, class Interpolation>
+    constexpr fixed_point<Rep, Exponent>
+    sin(const fixed_point<Rep, Exponent>& x, lookup_trig_tag<TableSize, Interpolation>) noexcept
+    {
+        using traits = _impl::fp::trig::rep_traits<Rep>;
+        return fixed_point<Rep, Exponent>::from_data(
+                _impl::fp::trig::lookup<Rep, Exponent, TableSize, Interpolation>::sin(
+                        traits::negative(x.data()), traits::magnitude(x.data()), 0));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::cos
+
+    /// \brief calculates the cosine of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x angle in radians
+    ///
+    /// \return cosine of x, saturated to the range of the result type
+    ///
+    /// \note Uses integer-only CORDIC iteration; the result is accurate to 1 LSB
+    /// for representations of up to 32 bits.
+    /// Representations of more than 64 bits are converted to and from floating-point instead.
+    ///
+    /// \sa sin, atan2
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent>
+    cos(const fixed_point<Rep, Exponent>& x, cordic_trig_tag = cordic_trig) noexcept
+    {
+        return _impl::fp::trig::cos(x, _impl::fp::trig::wide<Rep>{});
+    }
+
+    /// \brief calculates the cosine of a \ref fixed_point value using a quarter-wave lookup table
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x angle in radians
+    ///
+    /// \return cosine of x, saturated to the range of the result type
+    ///
+    /// \note Accuracy is as for the lookup overload of \ref sin.
+    ///
+    /// \sa sin, lookup_trig_tag
+    template<class Rep, int Exponent, int TableSize, class Interpolation>
+    constexpr fixed_point<Rep, Exponent>
+    cos(const fixed_point<Rep, Exponent>& x, lookup_trig_tag<TableSize, Interpolation>) noexcept
+    {
+        using traits = _impl::fp::trig::rep_traits<Rep>;
+        return fixed_point<Rep, Exponent>::from_data(
+                _impl::fp::trig::lookup<Rep, Exponent, TableSize, Interpolation>::sin(
+                        false, traits::magnitude(x.data()), 1));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::atan2
+
+    /// \brief calculates the angle in radians between the positive x axis and point (x, y)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param y ordinate
+    /// \param x abscissa
+    ///
+    /// \return angle in the range [-pi, pi], saturated to the range of the result type;
+    /// zero if both x and y are zero
+    ///
+    /// \note Uses integer-only CORDIC iteration; the result is accurate to 1 LSB
+    /// for representations of up to 32 bits.
+    /// Representations of more than 64 bits are converted to and from floating-point instead.
+    ///
+    /// \sa sin, cos, hypot
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent>
+    atan2(const fixed_point<Rep, Exponent>& y, const fixed_point<Rep, Exponent>& x) noexcept
+    {
+        return _impl::fp::trig::atan2(y, x, _impl::fp::trig::wide<Rep>{});
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::hypot
+
+    /// \brief calculates the square root of the sum of the squares of two \ref fixed_point values
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x first value
+    /// \param y second value
+    ///
+    /// \return length of the vector (x, y), saturated to the range of the result type
+    ///
+    /// \note Uses integer-only CORDIC iteration and never overflows an intermediate value;
+    /// the result is accurate to 1 LSB for representations of up to 32 bits.
+    /// Representations of more than 64 bits are converted to and from floating-point instead.
+    ///
+    /// \sa sqrt, atan2
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent>
+    hypot(const fixed_point<Rep, Exponent>& x, const fixed_point<Rep, Exponent>& y) noexcept
+    {
+        return _impl::fp::trig::hypot(x, y, _impl::fp::trig::wide<Rep>{});
+    }
+}
+
+#endif	// SG14_FIXED_POINT_TRIG_H
@@ -0,0 +1,131 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief 64-bit integer helpers shared by the integer-only math functions of `sg14::fixed_point`;
+/// included from sg14/fixed_point - do not include directly!
+
+#if !defined(SG14_FIXED_POINT_WORKING_H)
+#define SG14_FIXED_POINT_WORKING_H 1
+
+#include "fixed_point_type.h"
+
+#include <sg14/auxiliary/numeric.h>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    namespace _impl {
+        namespace fp {
+            namespace working {
+                // intermediate values of any Rep up to 64 bits are held in these types
+                using working_rep = std::int64_t;
+                using uworking_rep = std::uint64_t;
+
+                // shifts left by positive shift and right by negative shift;
+                // yields zero when every bit is shifted out
+                constexpr uworking_rep shift_left(uworking_rep n, int shift)
+                {
+                    return (shift>=64 || shift<=-64) ? 0 : (shift>=0) ? n << shift : n >> -shift;
+                }
+
+                constexpr uworking_rep magnitude(working_rep n)
+                {
+                    return (n<0) ? uworking_rep{0}-static_cast<uworking_rep>(n) : static_cast<uworking_rep>(n);
+                }
+
+                // number of bits needed to represent n
+                constexpr int used_bits(uworking_rep n)
+                {
+#if !defined(_MSC_VER) && !defined(SG14_DISABLE_GCC_BUILTINS)
+                    return n ? 64-__builtin_clzll(n) : 0;
+#else
+                    return sg14::used_bits(n);
+#endif
+                }
+
+                constexpr working_rep negate_if(bool negate, working_rep n)
+                {
+                    return negate ? -n : n;
+                }
+
+                template<class Rep>
+                constexpr working_rep rep_max()
+                {
+                    return std::numeric_limits<working_rep>::max()
+                            >> (63-((digits<Rep>::value<63) ? digits<Rep>::value : 63));
+                }
+
+                template<class Rep, bool IsSigned = is_signed<Rep>::value>
+                struct rep_traits {
+                    static constexpr bool negative(const Rep&)
+                    {
+                        return false;
+                    }
+
+                    static constexpr uworking_rep magnitude(const Rep& rep)
+                    {
+                        return static_cast<uworking_rep>(rep);
+                    }
+
+                    static constexpr working_rep min()
+                    {
+                        return 0;
+                    }
+                };
+
+                template<class Rep>
+                struct rep_traits<Rep, true> {
+                    static constexpr bool negative(const Rep& rep)
+                    {
+                        return static_cast<working_rep>(rep)<0;
+                    }
+
+                    static constexpr uworking_rep magnitude(const Rep& rep)
+                    {
+                        return working::magnitude(static_cast<working_rep>(rep));
+                    }
+
+                    static constexpr working_rep min()
+                    {
+                        return -rep_max<Rep>()-1;
+                    }
+                };
+
+                template<class Rep>
+                constexpr Rep saturate(working_rep n)
+                {
+                    return static_cast<Rep>((n>rep_max<Rep>())
+                                            ? rep_max<Rep>()
+                                            : (n<rep_traits<Rep>::min()) ? rep_traits<Rep>::min() : n);
+                }
+
+                template<class Rep>
+                constexpr Rep saturate(uworking_rep n)
+                {
+                    return static_cast<Rep>((n>static_cast<uworking_rep>(rep_max<Rep>())) ? rep_max<Rep>() : n);
+                }
+
+                // shifts n left by positive shift and right by negative shift,
+                // rounding to nearest and saturating
+                template<class Rep>
+                constexpr Rep scale(working_rep n, int shift)
+                {
+                    return (shift<=0)
+                           ? (shift<-63)
+                             ? Rep{0}
+                             : saturate<Rep>((shift==0) ? n : (n >> -shift)+((n >> (-shift-1)) & 1))
+                           : (shift>=63 || n>(std::numeric_limits<working_rep>::max() >> shift)
+                              || n<(std::numeric_limits<working_rep>::min() >> shift))
+                             ? saturate<Rep>((n>0) ? std::numeric_limits<working_rep>::max()
+                                                   : (n<0) ? std::numeric_limits<working_rep>::min() : 0)
+                             : saturate<Rep>(n*(working_rep{1} << shift));
+                }
+            }
+        }
+    }
+}
+
+#endif	// SG14_FIXED_POINT_WORKING_H
@@ -6,8 +6,21 @@
 
 #include "sample_functions.h"
 
+#include <sg14/auxiliary/batch.h>
+#include <sg14/auxiliary/elastic_integer.h>
+#include <sg14/auxiliary/biquad_cascade.h>
+#include <sg14/auxiliary/fft.h>
+#include <sg14/auxiliary/fir_filter.h>
+#include <sg14/auxiliary/gemm.h>
+#include <sg14/auxiliary/precise_integer.h>
+#include <sg14/auxiliary/safe_integer.h>
+
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
 #define ESCAPE(X) escape_cppcon2015(&X)
 //#define ESCAPE(X) escape_codedive2015(&X)
 //#define ESCAPE(x) benchmark::DoNotOptimize(x)
@@ -19,7 +32,15 @@ using sg14::make_ufixed;
 ////////////////////////////////////////////////////////////////////////////////
 // entry point
 
-BENCHMARK_MAIN();
+// reports the instruction set of the vector kernels to stderr so as not to disturb formatted output
+int main(int argc, char** argv)
+{
+    std::fprintf(stderr, "sg14::selected_instruction_set: %s\n",
+            sg14::instruction_set_name(sg14::selected_instruction_set()));
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 // optimization circumvention:
@@ -111,6 +132,54 @@ static void div(benchmark::State& state)
     }
 }
 
+template<class T>
+static void bm_divide_reciprocal(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    auto denom = static_cast<T>(numeric_limits<T>::max()/int8_t{3});
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        ESCAPE(denom);
+        auto value = divide(nume, denom, sg14::reciprocal_division);
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+static void bm_divide_cached(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    auto const denom = sg14::reciprocal_divisor<typename T::rep, T::exponent>{
+            static_cast<T>(numeric_limits<T>::max()/int8_t{3})};
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        auto value = denom.quotient(nume);
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+static void bm_divide_const_integer(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        auto value = nume/sg14::const_integer<int, 7>{};
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+static void bm_divide_literal(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        auto value = nume/7;
+        ESCAPE(value);
+    }
+}
+
 template<class T>
 static void bm_sqrt(benchmark::State& state)
 {
@@ -122,6 +191,567 @@ static void bm_sqrt(benchmark::State& state)
     }
 }
 
+template<class T>
+static void bm_sqrt_divide(benchmark::State& state)
+{
+    auto input = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = T{1}/sqrt(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_rsqrt(benchmark::State& state)
+{
+    auto input = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = rsqrt(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_sin(benchmark::State& state)
+{
+    using std::sin;
+    auto input = T{1};
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = sin(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T, class Tag>
+static void bm_sin_lookup(benchmark::State& state)
+{
+    auto input = T{1};
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = sin(input, Tag{});
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_tanh(benchmark::State& state)
+{
+    using std::tanh;
+    auto input = T{.75};
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = tanh(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_gelu(benchmark::State& state)
+{
+    auto input = T{.75};
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = gelu(input);
+        ESCAPE(output);
+    }
+}
+
+// 4096 values in the range, (0, 8]
+template<class T>
+static std::vector<T> ramp()
+{
+    auto values = std::vector<T>(4096);
+    for (auto i = std::size_t{0}; i!=values.size(); ++i) {
+        values[i] = static_cast<T>((i+1)/512.);
+    }
+    return values;
+}
+
+// a scalar loop vs. the batch function choosing its own instructions
+template<class T>
+static void bm_sin_loop(benchmark::State& state)
+{
+    auto const input = ramp<T>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        std::transform(input.begin(), input.end(), output.begin(), [](T x) { return sin(x); });
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+}
+
+template<class T>
+static void bm_sin_batch(benchmark::State& state)
+{
+    auto const input = ramp<T>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        sin(input.data(), input.data()+input.size(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T>
+static void bm_log2_loop(benchmark::State& state)
+{
+    auto const input = ramp<T>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        std::transform(input.begin(), input.end(), output.begin(), [](T x) { return log2(x); });
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+}
+
+template<class T>
+static void bm_log2_batch(benchmark::State& state)
+{
+    auto const input = ramp<T>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        log2(input.data(), input.data()+input.size(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T>
+static void bm_convert_loop(benchmark::State& state)
+{
+    auto const input = ramp<float>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        std::transform(input.begin(), input.end(), output.begin(), [](float x) { return T{x}; });
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+}
+
+template<class T>
+static void bm_convert_batch(benchmark::State& state)
+{
+    auto const input = ramp<float>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        convert(input.data(), input.data()+input.size(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T>
+static void bm_convert_saturated_batch(benchmark::State& state)
+{
+    auto const input = ramp<float>();
+    auto output = std::vector<T>(input.size());
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        convert(sg14::saturated_overflow, sg14::closest_rounding_tag{}, input.data(), input.data()+input.size(),
+                output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*input.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// 4096 values spread over the range of T
+template<class T>
+static std::vector<T> noise(unsigned seed)
+{
+    auto values = std::vector<T>(4096, T{0});
+    for (auto& value : values) {
+        seed = seed*1664525u+1013904223u;
+        value = T::from_data(static_cast<typename T::rep>(static_cast<std::int16_t>(seed >> 16)));
+    }
+    return values;
+}
+
+template<class T>
+static void bm_multiply_loop(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    auto output = std::vector<T>(lhs.size(), T{0});
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        for (auto i = std::size_t{0}; i!=lhs.size(); ++i) {
+            output[i] = lhs[i]*rhs[i];
+        }
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+}
+
+template<class T>
+static void bm_add_batch(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    auto output = std::vector<T>(lhs.size(), T{0});
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        add(lhs.data(), lhs.data()+lhs.size(), rhs.data(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T>
+static void bm_multiply_batch(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    auto output = std::vector<T>(lhs.size(), T{0});
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        multiply(lhs.data(), lhs.data()+lhs.size(), rhs.data(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T>
+static void bm_q_mul_round_loop(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    auto output = std::vector<T>(lhs.size());
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        for (auto i = std::size_t{0}; i!=lhs.size(); ++i) {
+            output[i] = q_mul_round(lhs[i], rhs[i]);
+        }
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+}
+
+template<class T>
+static void bm_q_mul_round_batch(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    auto output = std::vector<T>(lhs.size());
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        q_mul_round(lhs.data(), lhs.data()+lhs.size(), rhs.data(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T>
+static void bm_dot_loop(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        auto sum = std::int64_t{0};
+        for (auto i = std::size_t{0}; i!=lhs.size(); ++i) {
+            sum += std::int64_t{lhs[i].data()}*rhs[i].data();
+        }
+        ESCAPE(sum);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+}
+
+template<class T>
+static void bm_dot_batch(benchmark::State& state)
+{
+    auto const lhs = noise<T>(1);
+    auto const rhs = noise<T>(2);
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        auto sum = sg14::dot<4096>(lhs.data(), lhs.data()+lhs.size(), rhs.data());
+        ESCAPE(sum);
+    }
+    state.SetItemsProcessed(state.iterations()*lhs.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// a 1024-sample block filtered by Taps coefficients
+template<class T, std::size_t Taps>
+static void bm_fir_filter(benchmark::State& state)
+{
+    T coefficients[Taps];
+    auto const taps = noise<T>(3);
+    std::copy(taps.begin(), taps.begin()+Taps, coefficients);
+    auto filter = sg14::fir_filter<T, T, Taps>{coefficients};
+
+    auto const input = noise<T>(1);
+    auto output = std::vector<T>(1024);
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        filter.process(input.data(), input.data()+output.size(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*output.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+template<class T, std::size_t Taps, std::size_t Decimation>
+static void bm_decimating_fir_filter(benchmark::State& state)
+{
+    T coefficients[Taps];
+    auto const taps = noise<T>(3);
+    std::copy(taps.begin(), taps.begin()+Taps, coefficients);
+    auto filter = sg14::decimating_fir_filter<T, T, Taps, Decimation>{coefficients};
+
+    auto const input = noise<T>(1);
+    auto output = std::vector<T>(1024/Decimation);
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        filter.process(input.data(), input.data()+1024, output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*1024);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// 1024 frames of Channels interleaved channels filtered by Sections low-pass sections
+template<class Coeff, class Sample, std::size_t Sections, std::size_t Channels>
+static void bm_biquad_cascade(benchmark::State& state)
+{
+    Coeff coefficients[Sections][5];
+    for (auto& section : coefficients) {
+        section[0] = .0675;
+        section[1] = .135;
+        section[2] = .0675;
+        section[3] = -1.143;
+        section[4] = .4128;
+    }
+    auto filter = sg14::biquad_cascade<Coeff, Sample, Sections, Channels>{coefficients};
+
+    auto input = std::vector<Sample>{};
+    while (input.size()<1024*Channels) {
+        auto const block = noise<Sample>(static_cast<unsigned>(input.size()));
+        input.insert(input.end(), block.begin(), block.end());
+    }
+    auto output = std::vector<Sample>(1024*Channels, Sample{0});
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        filter.process(input.data(), input.data()+output.size(), output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*output.size());
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// multiply-accumulates of the product of two Size by Size matrices, one element at a time
+template<class T, std::size_t Size>
+static void bm_gemm_loop(benchmark::State& state)
+{
+    auto const a = noise<T>(1);
+    auto const b = noise<T>(2);
+    auto c = std::vector<sg14::gemm_result_t<T, T>>(Size*Size);
+    while (state.KeepRunning()) {
+        ESCAPE(a[0]);
+        for (auto i = std::size_t{0}; i!=Size; ++i) {
+            for (auto j = std::size_t{0}; j!=Size; ++j) {
+                auto sum = std::int32_t{0};
+                for (auto p = std::size_t{0}; p!=Size; ++p) {
+                    sum += std::int32_t{a[(i*Size+p)%a.size()].data()}*b[(p*Size+j)%b.size()].data();
+                }
+                c[i*Size+j] = decltype(c)::value_type::from_data(sum);
+            }
+        }
+        ESCAPE(c[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*Size*Size*Size);
+}
+
+// as bm_gemm_loop with sg14::gemm
+template<class T, std::size_t Size>
+static void bm_gemm(benchmark::State& state)
+{
+    auto a = std::vector<T>{};
+    auto b = std::vector<T>{};
+    for (auto seed = 0u; a.size()<Size*Size; ++seed) {
+        auto const block_a = noise<T>(seed*2+1);
+        auto const block_b = noise<T>(seed*2+2);
+        a.insert(a.end(), block_a.begin(), block_a.end());
+        b.insert(b.end(), block_b.begin(), block_b.end());
+    }
+    auto c = std::vector<sg14::gemm_result_t<T, T>>(Size*Size);
+    while (state.KeepRunning()) {
+        ESCAPE(a[0]);
+        sg14::gemm(Size, Size, Size, a.data(), Size, b.data(), Size, c.data(), Size);
+        ESCAPE(c[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*Size*Size*Size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// size complex values of noise in [-.5, .5)
+template<class T>
+static std::vector<std::complex<T>> complex_noise(std::size_t size)
+{
+    auto values = std::vector<std::complex<T>>(size);
+    auto seed = 1u;
+    for (auto& value : values) {
+        seed = seed*1664525u+1013904223u;
+        auto const real = static_cast<std::int16_t>(seed >> 16)/65536.;
+        seed = seed*1664525u+1013904223u;
+        auto const imag = static_cast<std::int16_t>(seed >> 16)/65536.;
+        value = std::complex<T>(static_cast<T>(real), static_cast<T>(imag));
+    }
+    return values;
+}
+
+// FFT of state.range(0) values with the Stockham autosort algorithm
+template<class T>
+static void bm_fft_stockham(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const plan = sg14::fft_plan<T>(size);
+    auto data = complex_noise<T>(size);
+    auto work = data;
+    while (state.KeepRunning()) {
+        ESCAPE(data[0]);
+        auto const output = sg14::fft(plan, data.data(), work.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// in-place FFT of state.range(0) values with the given algorithm
+template<class T, class Algorithm>
+static void bm_fft(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const plan = sg14::fft_plan<T>(size);
+    auto data = complex_noise<T>(size);
+    while (state.KeepRunning()) {
+        ESCAPE(data[0]);
+        sg14::fft(plan, data.data(), Algorithm{});
+        ESCAPE(data[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// as bm_fft with block floating point arithmetic
+template<class T, class Algorithm>
+static void bm_block_fft(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const plan = sg14::fft_plan<T>(size);
+    auto data = complex_noise<T>(size);
+    while (state.KeepRunning()) {
+        ESCAPE(data[0]);
+        auto exponent = sg14::block_fft(plan, data.data(), Algorithm{});
+        ESCAPE(exponent);
+    }
+    state.SetItemsProcessed(state.iterations()*size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// FFT of state.range(0) real values as state.range(0)/2 complex values
+template<class T>
+static void bm_rfft(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const plan = sg14::rfft_plan<T>(size);
+    auto const noise = complex_noise<T>(size/2);
+    auto const input = reinterpret_cast<const T*>(noise.data());
+    auto output = std::vector<std::complex<T>>(size/2);
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        sg14::rfft(plan, input, output.data());
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// as bm_rfft with block floating point arithmetic
+template<class T>
+static void bm_block_rfft(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const plan = sg14::rfft_plan<T>(size);
+    auto const noise = complex_noise<T>(size/2);
+    auto const input = reinterpret_cast<const T*>(noise.data());
+    auto output = std::vector<std::complex<T>>(size/2);
+    while (state.KeepRunning()) {
+        ESCAPE(input[0]);
+        auto exponent = sg14::block_rfft(plan, input, output.data());
+        ESCAPE(exponent);
+    }
+    state.SetItemsProcessed(state.iterations()*size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// 512 in-place FFTs of state.range(0) values divided among a pool of state.range(1) threads
+template<class T>
+static void bm_batch_fft(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const count = std::size_t{512};
+    auto const threads = static_cast<unsigned>(state.range(1));
+    auto const plan = sg14::fft_plan<T>(size);
+    auto data = complex_noise<T>(size*count);
+    sg14::fft_thread_pool pool(threads);
+    while (state.KeepRunning()) {
+        ESCAPE(data[0]);
+        sg14::batch_fft(plan, data.data(), count, pool);
+        ESCAPE(data[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*size*count);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// in-place FFT of state.range(0) values with each stage divided among a pool of state.range(1) threads
+template<class T>
+static void bm_parallel_fft(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const threads = static_cast<unsigned>(state.range(1));
+    auto const plan = sg14::fft_plan<T>(size);
+    auto data = complex_noise<T>(size);
+    sg14::fft_thread_pool pool(threads);
+    while (state.KeepRunning()) {
+        ESCAPE(data[0]);
+        sg14::parallel_fft(plan, data.data(), pool);
+        ESCAPE(data[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*size);
+    state.SetLabel(sg14::instruction_set_name(sg14::selected_instruction_set()));
+}
+
+// Taylor series of sin(x) to x^9
+template<class T, class Tag>
+static void bm_polynomial(benchmark::State& state)
+{
+    using poly = sg14::polynomial<T,
+            T{0}.data(), T{1}.data(), T{0}.data(), T{-1./6}.data(), T{0}.data(),
+            T{1./120}.data(), T{0}.data(), T{-1./5040}.data(), T{0}.data(), T{1./362880}.data()>;
+    auto input = T{.5};
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = poly::evaluate(input, Tag{});
+        ESCAPE(output);
+    }
+}
+
 template<class T>
 static void bm_magnitude_squared(benchmark::State& state)
 {
@@ -250,5 +880,127 @@ FIXED_POINT_BENCHMARK_REAL(bm_magnitude_squared);
 
 FIXED_POINT_BENCHMARK_REAL(bm_circle_intersect_generic);
 
-// tests involving unoptimized math function, sg14::sqrt
+// division by multiplying by a reciprocal, calculated per division or once for many dividends
+FIXED_POINT_BENCHMARK_FIXED(bm_divide_reciprocal);
+FIXED_POINT_BENCHMARK_FIXED(bm_divide_cached);
+
+// division by a constant: multiply-high by a magic number vs. the built-in operator on the widened rep
+#if defined(SG14_INT128_ENABLED)
+using elastic_64 = sg14::elastic_integer<64>;
+BENCHMARK_TEMPLATE1(bm_divide_const_integer, elastic_64);
+BENCHMARK_TEMPLATE1(bm_divide_literal, elastic_64);
+#endif
+
+// square root and reciprocal square root, including 1/sqrt(x) for comparison with sg14::rsqrt
 FIXED_POINT_BENCHMARK_REAL(bm_sqrt);
+FIXED_POINT_BENCHMARK_REAL(bm_sqrt_divide);
+FIXED_POINT_BENCHMARK_FIXED(bm_rsqrt);
+
+// trigonometric functions: CORDIC, quarter-wave table lookup and floating-point
+FIXED_POINT_BENCHMARK_FLOAT(bm_sin);
+BENCHMARK_TEMPLATE1(bm_sin, s7_8);
+BENCHMARK_TEMPLATE1(bm_sin, s15_16);
+
+using lookup_64 = sg14::lookup_trig_tag<64>;
+using lookup_256 = sg14::lookup_trig_tag<256>;
+using lookup_256_quadratic = sg14::lookup_trig_tag<256, sg14::quadratic_interpolation_tag>;
+BENCHMARK_TEMPLATE2(bm_sin_lookup, s7_8, lookup_64);
+BENCHMARK_TEMPLATE2(bm_sin_lookup, s15_16, lookup_256);
+BENCHMARK_TEMPLATE2(bm_sin_lookup, s15_16, lookup_256_quadratic);
+
+// activation functions
+FIXED_POINT_BENCHMARK_FLOAT(bm_tanh);
+BENCHMARK_TEMPLATE1(bm_tanh, s7_8);
+BENCHMARK_TEMPLATE1(bm_tanh, s15_16);
+BENCHMARK_TEMPLATE1(bm_gelu, s7_8);
+BENCHMARK_TEMPLATE1(bm_gelu, s15_16);
+
+// batch math functions
+BENCHMARK_TEMPLATE1(bm_sin_loop, s15_16);
+BENCHMARK_TEMPLATE1(bm_sin_batch, s15_16);
+BENCHMARK_TEMPLATE1(bm_log2_loop, s15_16);
+BENCHMARK_TEMPLATE1(bm_log2_batch, s15_16);
+BENCHMARK_TEMPLATE1(bm_convert_loop, s15_16);
+BENCHMARK_TEMPLATE1(bm_convert_batch, s15_16);
+BENCHMARK_TEMPLATE1(bm_convert_saturated_batch, s15_16);
+
+// batch saturating arithmetic
+using q15 = sg14::fixed_point<sg14::safe_integer<std::int16_t, sg14::saturated_overflow_tag>, -15>;
+BENCHMARK_TEMPLATE1(bm_multiply_loop, q15);
+BENCHMARK_TEMPLATE1(bm_add_batch, q15);
+BENCHMARK_TEMPLATE1(bm_multiply_batch, q15);
+
+// rounding multiplication of Q15 and Q31
+using q15_native = make_fixed<0, 15>;
+using q31_native = make_fixed<0, 31>;
+BENCHMARK_TEMPLATE1(bm_q_mul_round_loop, q15_native);
+BENCHMARK_TEMPLATE1(bm_q_mul_round_batch, q15_native);
+BENCHMARK_TEMPLATE1(bm_q_mul_round_loop, q31_native);
+BENCHMARK_TEMPLATE1(bm_q_mul_round_batch, q31_native);
+
+// dot product of Q15
+BENCHMARK_TEMPLATE1(bm_dot_loop, q15_native);
+BENCHMARK_TEMPLATE1(bm_dot_batch, q15_native);
+
+// FIR filters of Q15
+BENCHMARK_TEMPLATE2(bm_fir_filter, q15_native, 32);
+BENCHMARK_TEMPLATE2(bm_fir_filter, q15_native, 128);
+BENCHMARK_TEMPLATE(bm_decimating_fir_filter, q15_native, 128, 4);
+
+// IIR filters of Q15 with Q1.14 coefficients, e.g. 32-channel audio
+using q14_native = make_fixed<1, 14>;
+BENCHMARK_TEMPLATE(bm_biquad_cascade, q14_native, q15_native, 4, 1);
+BENCHMARK_TEMPLATE(bm_biquad_cascade, q14_native, q15_native, 4, 32);
+
+// matrix multiplication of 8- and 16-bit values
+using q7_native = make_fixed<0, 7>;
+BENCHMARK_TEMPLATE(bm_gemm_loop, q7_native, 256);
+BENCHMARK_TEMPLATE(bm_gemm, q7_native, 256);
+BENCHMARK_TEMPLATE(bm_gemm, q15_native, 256);
+BENCHMARK_TEMPLATE(bm_gemm, q15_native, 1024);
+
+// FFTs of 64 to 65536 values of Q1.30: radix-2, radix-4 and split-radix
+using q30_native = make_fixed<1, 30>;
+using radix_2 = sg14::radix_2_tag;
+using radix_4 = sg14::radix_4_tag;
+using split_radix = sg14::split_radix_tag;
+BENCHMARK_TEMPLATE1(bm_fft_stockham, q30_native)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK_TEMPLATE2(bm_fft, q30_native, radix_2)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK_TEMPLATE2(bm_fft, q30_native, radix_4)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK_TEMPLATE2(bm_fft, q30_native, split_radix)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK_TEMPLATE2(bm_block_fft, q30_native, radix_2)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK_TEMPLATE2(bm_block_fft, q30_native, radix_4)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK_TEMPLATE2(bm_block_fft, q30_native, split_radix)->RangeMultiplier(4)->Range(64, 65536);
+
+// radix-2 FFTs of Q1.14 and Q1.30 with vector butterflies vs. single precision
+BENCHMARK_TEMPLATE1(bm_fft_stockham, float)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE1(bm_fft_stockham, q14_native)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE2(bm_fft, float, radix_2)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE2(bm_fft, q14_native, radix_2)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE2(bm_block_fft, q14_native, radix_2)->RangeMultiplier(16)->Range(256, 65536);
+
+// FFTs of real values vs. those of as many complex values
+BENCHMARK_TEMPLATE1(bm_rfft, float)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE1(bm_rfft, q14_native)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE1(bm_rfft, q30_native)->RangeMultiplier(16)->Range(256, 65536);
+BENCHMARK_TEMPLATE1(bm_block_rfft, q14_native)->RangeMultiplier(16)->Range(256, 65536);
+
+// 512 transforms of 1024 values and single transforms of 2^18 and 2^20 values on 1, 2 and 4 threads
+BENCHMARK_TEMPLATE1(bm_batch_fft, q14_native)
+        ->Args({1024, 1})->Args({1024, 2})->Args({1024, 4})->UseRealTime();
+BENCHMARK_TEMPLATE1(bm_parallel_fft, q14_native)
+        ->Args({1 << 18, 1})->Args({1 << 18, 2})->Args({1 << 18, 4})->UseRealTime();
+BENCHMARK_TEMPLATE1(bm_parallel_fft, q30_native)
+        ->Args({1 << 20, 1})->Args({1 << 20, 2})->Args({1 << 20, 4})->UseRealTime();
+
+// polynomial evaluation: Horner's scheme and Estrin's scheme
+using s3_28 = make_fixed<3, 28>;
+using horner = sg14::horner_tag;
+using estrin = sg14::estrin_tag;
+BENCHMARK_TEMPLATE2(bm_polynomial, s3_28, horner);
+BENCHMARK_TEMPLATE2(bm_polynomial, s3_28, estrin);
+#if defined(SG14_INT128_ENABLED)
+using s3_60 = make_fixed<3, 60>;
+BENCHMARK_TEMPLATE2(bm_polynomial, s3_60, horner);
+BENCHMARK_TEMPLATE2(bm_polynomial, s3_60, estrin);
+#endif
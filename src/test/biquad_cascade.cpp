@@ -0,0 +1,161 @@
+
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/biquad_cascade.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    using sg14::fixed_point;
+    using sg14::instruction_set;
+
+    using q14 = fixed_point<std::int16_t, -14>;
+    using q15 = fixed_point<std::int16_t, -15>;
+
+    static_assert(std::is_same<sg14::biquad_cascade<q14, q15, 4>::state_type,
+            fixed_point<std::int64_t, -29>>::value, "sg14::biquad_cascade test failed");
+    static_assert(std::is_same<sg14::biquad_cascade<fixed_point<std::int8_t, -6>, fixed_point<std::int8_t, -7>, 4>::state_type,
+            fixed_point<std::int32_t, -13>>::value, "sg14::biquad_cascade test failed");
+
+    // a low-pass, a resonant band-pass with gain enough to saturate and a high-pass
+    q14 const coefficients[3][5] = {
+            {.0675, .135, .0675, -1.143, .4128},
+            {.8, 0., -.8, -1.6, .95},
+            {.9, -1.8, .9, -1.78, .82}};
+
+    // interleaved frames of a pseudo-random signal including runs of the lowest value
+    std::vector<q15> signal(std::size_t channels)
+    {
+        auto samples = std::vector<q15>{};
+        auto seed = 1u;
+        for (auto i = std::size_t{0}; i!=500*channels; ++i) {
+            seed = seed*1664525u+1013904223u;
+            samples.push_back((i%300<20)
+                              ? std::numeric_limits<q15>::lowest()
+                              : q15::from_data(static_cast<std::int16_t>(seed >> 16)));
+        }
+        return samples;
+    }
+
+    // each channel filtered one section at a time with the given order of error feedback
+    std::vector<q15> filter(const std::vector<q15>& input, std::size_t channels, int feedback_order)
+    {
+        auto output = input;
+        for (auto const& c : coefficients) {
+            for (auto channel = std::size_t{0}; channel!=channels; ++channel) {
+                std::int64_t s1 = 0, s2 = 0, e1 = 0, e2 = 0;
+                for (auto n = channel; n<output.size(); n += channels) {
+                    std::int64_t const x = output[n].data();
+                    auto const feedback = (feedback_order==0) ? 0 : (feedback_order==1) ? e1 : 2*e1-e2;
+                    auto const accumulator = c[0].data()*x+s1+feedback;
+                    std::int64_t const y = std::min(std::max(accumulator >> 14, std::int64_t{-32768}),
+                            std::int64_t{32767});
+                    e2 = e1;
+                    e1 = accumulator & 0x3fff;
+                    s1 = c[1].data()*x-c[3].data()*y+s2;
+                    s2 = c[2].data()*x-c[4].data()*y;
+                    output[n] = q15::from_data(static_cast<std::int16_t>(y));
+                }
+            }
+        }
+        return output;
+    }
+
+    template<class Quantization>
+    void test_biquad_cascade(std::size_t channels)
+    {
+        constexpr auto order = sg14::_impl::biquad::feedback_order<Quantization>::value;
+        using state = sg14::_impl::biquad::state<q14, q15, order>;
+        using key = sg14::_impl::fp::batch::biquad_key<q14, q15, typename state::rep, 3, order>;
+        using registry = sg14::_impl::dispatch::registry<key>;
+
+        q14 flattened[15];
+        std::copy(&coefficients[0][0], &coefficients[0][0]+15, flattened);
+
+        auto const input = signal(channels);
+        auto const expected = filter(input, channels, order);
+
+        for (auto set : {instruction_set::scalar, instruction_set::sse4_1, instruction_set::avx2,
+                         instruction_set::avx512}) {
+            if (set>sg14::supported_instruction_set()) {
+                continue;
+            }
+
+            // in two blocks to exercise the continuation of the state between calls
+            auto states = std::vector<typename state::rep>(3*key::state_count*channels);
+            auto output = std::vector<q15>(input.size(), q15{0});
+            auto const middle = 123*channels;
+            registry::select(set)(flattened, states.data(), channels,
+                    input.data(), input.data()+middle, output.data());
+            registry::select(set)(flattened, states.data(), channels,
+                    input.data()+middle, input.data()+input.size(), output.data()+middle);
+
+            for (auto n = std::size_t{0}; n!=input.size(); ++n) {
+                ASSERT_EQ(expected[n], output[n])
+                                            << sg14::instruction_set_name(set) << ", channels=" << channels
+                                            << ", order=" << order << ", n=" << n;
+            }
+        }
+    }
+
+    TEST(biquad_cascade, instruction_sets)
+    {
+        for (auto channels : {1, 3, 11, 32}) {
+            test_biquad_cascade<sg14::truncation_quantization_tag>(channels);
+            test_biquad_cascade<sg14::error_feedback_quantization_tag>(channels);
+            test_biquad_cascade<sg14::noise_shaping_quantization_tag>(channels);
+        }
+    }
+
+    TEST(biquad_cascade, impulse_response)
+    {
+        // y[n] = x[n]/2 + y[n-1]/2
+        q14 const sections[1][5] = {{.5, 0., 0., -.5, 0.}};
+        auto filter = sg14::biquad_cascade<q14, q15, 1, 2>{sections};
+
+        q15 samples[16] = {.5, -.5};
+        std::fill(samples+2, samples+16, q15{0});
+        ASSERT_EQ(samples+16, filter.process(samples, samples+16, samples));
+        for (auto frame = 0; frame!=8; ++frame) {
+            EXPECT_EQ(q15{.25/(1 << frame)}, samples[frame*2]);
+            EXPECT_EQ(q15{-.25/(1 << frame)}, samples[frame*2+1]);
+        }
+
+        filter.reset();
+        q15 const impulse[2] = {.5, .5};
+        q15 output[2];
+        filter.process(impulse, impulse+2, output);
+        EXPECT_EQ(.25, output[0]);
+        EXPECT_EQ(.25, output[1]);
+    }
+
+    // the sum of the outputs of a constant input includes the error of only the last output
+    TEST(biquad_cascade, error_feedback)
+    {
+        q14 const sections[1][5] = {{q14::from_data(5461), 0., 0., 0., 0.}};
+        auto const input = std::vector<q15>(3000, q15::from_data(1001));
+        auto const exact = std::int64_t{5461}*1001*3000;
+
+        auto truncated = std::vector<q15>(input.size(), q15{0});
+        sg14::biquad_cascade<q14, q15, 1>{sections}.process(input.data(), input.data()+input.size(), truncated.data());
+        auto fed_back = std::vector<q15>(input.size(), q15{0});
+        sg14::biquad_cascade<q14, q15, 1, 1, sg14::error_feedback_quantization_tag>{sections}.process(
+                input.data(), input.data()+input.size(), fed_back.data());
+
+        auto truncated_sum = std::int64_t{0};
+        auto fed_back_sum = std::int64_t{0};
+        for (auto n = std::size_t{0}; n!=input.size(); ++n) {
+            truncated_sum += truncated[n].data();
+            fed_back_sum += fed_back[n].data();
+        }
+        EXPECT_GT(exact-(truncated_sum << 14), std::int64_t{1000} << 14);
+        EXPECT_LE(std::int64_t{0}, exact-(fed_back_sum << 14));
+        EXPECT_GT(std::int64_t{1} << 14, exact-(fed_back_sum << 14));
+    }
+}
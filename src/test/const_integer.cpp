@@ -10,6 +10,8 @@
 #include <sg14/auxiliary/const_integer.h>
 #include <sg14/bits/type_traits.h>
 
+#include <gtest/gtest.h>
+
 namespace {
     using sg14::_impl::identical;
 
@@ -72,6 +74,56 @@ namespace {
         static_assert(identical(static_cast<int>(const_integer<long, 77213>{}), 77213), "sg14::const_integer test failed");
     }
 
+    namespace test_divide {
+        using namespace sg14::literals;
+        using sg14::const_integer;
+        using sg14::_const_integer_impl::divide_strategy;
+        using sg14::_const_integer_impl::get_divide_strategy;
+        using sg14::_const_integer_impl::magnitude_divider;
+        using sg14::_const_integer_impl::divide_integer;
+
+        static_assert(sg14::_const_integer_impl::magic_ceil(3, 2)==2, "sg14::_const_integer_impl::magic_ceil test failed");
+        static_assert(sg14::_const_integer_impl::magic_ceil(3, 33)==0xaaaaaaab, "sg14::_const_integer_impl::magic_ceil test failed");
+        static_assert(sg14::_const_integer_impl::magic_ceil(7, 67)==0x2492492492492493, "sg14::_const_integer_impl::magic_ceil test failed");
+
+        static_assert(get_divide_strategy(1, 64)==divide_strategy::shift, "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(UINT64_C(0x8000000000000001), 64)==divide_strategy::compare,
+                "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(10, 31)==divide_strategy::multiply, "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(10, 32)==divide_strategy::multiply_high, "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(UINT64_C(0x123456789abcdef), 8)==divide_strategy::multiply_high,
+                "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(UINT64_C(0x100000001), 31)==divide_strategy::multiply_high,
+                "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(UINT64_C(0xffffffff), 31)==divide_strategy::multiply,
+                "sg14::_const_integer_impl::get_divide_strategy test failed");
+        static_assert(get_divide_strategy(7, 64)==divide_strategy::multiply_high_add, "sg14::_const_integer_impl::get_divide_strategy test failed");
+
+        static_assert(magnitude_divider<7, 31>::divide(0x7fffffff)==0x7fffffff/7, "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<UINT64_C(0x123456789abcdef), 8>::divide(0xff)==0,
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<UINT64_C(0x123456789abcdef), 31>::divide(0x7fffffff)==0,
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<UINT64_C(0xffffffff), 31>::divide(0x7fffffff)==0,
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<UINT64_C(0x100000001), 31>::divide(0x7fffffff)==0,
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<UINT64_C(0x123456789abcdef), 63>::divide(UINT64_C(0x7fffffffffffffff))
+                      ==UINT64_C(0x7fffffffffffffff)/UINT64_C(0x123456789abcdef),
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<641, 48>::divide(UINT64_C(0xffffffffffff))==UINT64_C(0xffffffffffff)/641,
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<7, 64>::divide(UINT64_MAX)==UINT64_MAX/7, "sg14::_const_integer_impl::magnitude_divider test failed");
+        static_assert(magnitude_divider<UINT64_C(0x8000000000000001), 64>::divide(UINT64_MAX)==1,
+                "sg14::_const_integer_impl::magnitude_divider test failed");
+
+        static_assert(identical(divide_integer(-7, 2_c), -3), "sg14::_const_integer_impl::divide_integer test failed");
+        static_assert(identical(divide_integer(INT64_MIN, 10_c), INT64_MIN/10), "sg14::_const_integer_impl::divide_integer test failed");
+        static_assert(identical(divide_integer(INT64_MIN, 1_c), INT64_MIN), "sg14::_const_integer_impl::divide_integer test failed");
+        static_assert(identical(divide_integer(std::int8_t{-128}, -3_c), std::int8_t{42}),
+                "sg14::_const_integer_impl::divide_integer test failed");
+    }
+
     namespace test_literals {
         using namespace sg14::literals;
         using sg14::const_integer;
@@ -99,3 +151,50 @@ namespace {
                 "sg14::const_integer addition test failed");
     }
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// division by const_integer matches the built-in operator
+
+namespace {
+    template<std::uint64_t Divisor, int Digits>
+    void test_magnitude_divider()
+    {
+        using divider = sg14::_const_integer_impl::magnitude_divider<Divisor, Digits>;
+        auto const max = (Digits<64) ? (UINT64_C(1) << (Digits%64))-1 : UINT64_MAX;
+        for (auto n = max; n>0; n = (n/3)*2) {
+            ASSERT_EQ(divider::divide(n), n/Divisor) << n;
+            ASSERT_EQ(divider::divide(n-1), (n-1)/Divisor) << n-1;
+            ASSERT_EQ(divider::divide(max-n), (max-n)/Divisor) << max-n;
+        }
+        for (std::uint64_t n = 0; n<=max && n!=100000; ++n) {
+            ASSERT_EQ(divider::divide(n), n/Divisor) << n;
+            ASSERT_EQ(divider::divide(max-n), (max-n)/Divisor) << max-n;
+        }
+    }
+
+    template<std::uint64_t Divisor>
+    void test_magnitude_divider()
+    {
+        test_magnitude_divider<Divisor, 8>();
+        test_magnitude_divider<Divisor, 16>();
+        test_magnitude_divider<Divisor, 31>();
+        test_magnitude_divider<Divisor, 32>();
+        test_magnitude_divider<Divisor, 48>();
+        test_magnitude_divider<Divisor, 63>();
+        test_magnitude_divider<Divisor, 64>();
+    }
+}
+
+TEST(const_integer, divide)
+{
+    test_magnitude_divider<1>();
+    test_magnitude_divider<3>();
+    test_magnitude_divider<7>();
+    test_magnitude_divider<10>();
+    test_magnitude_divider<64>();
+    test_magnitude_divider<641>();
+    test_magnitude_divider<1000000007>();
+    test_magnitude_divider<UINT64_C(0x123456789abcdef)>();
+    test_magnitude_divider<UINT64_C(0x8000000000000000)>();
+    test_magnitude_divider<UINT64_C(0x8000000000000001)>();
+}
@@ -165,6 +165,16 @@ namespace {
                 "sg14::elastic_integer test failed");
         static_assert(identical(elastic_integer<10>{777}/10_c, elastic_integer<10>{77}),
                 "sg14::elastic_integer test failed");
+        static_assert(identical(elastic_integer<10>{-777}/-7_c, elastic_integer<10>{111}),
+                "sg14::elastic_integer test failed");
+        static_assert(identical(elastic_integer<31>{-0x7fffffff}/3_c, elastic_integer<31>{-0x7fffffff/3}),
+                "sg14::elastic_integer test failed");
+#if defined(SG14_INT128_ENABLED)
+        static_assert(identical(elastic_integer<64>{-INT64_MAX}*2/7_c, elastic_integer<64>{-INT64_MAX}*2/7),
+                "sg14::elastic_integer test failed");
+        static_assert(elastic_integer<64, unsigned>{UINT64_MAX}/10_c==UINT64_MAX/10,
+                "sg14::elastic_integer test failed");
+#endif
     }
 
     namespace test_bitwise_not {
@@ -9,11 +9,12 @@
 #include <iostream>
 #include <iomanip>
 #include <complex>
+#include <stdexcept>
 #include <vector>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <sg14/auxiliary/elastic_fixed_point.h>
-#include "fft.h"
+#include <sg14/auxiliary/fft.h>
 
 
 TEST(fft, safft_double)
@@ -25,10 +26,8 @@ TEST(fft, safft_double)
     std::vector<std::complex<double>> vec1(fftSize,std::complex<double>(0.0,0.0));
     vec1[impulseLoc] = std::complex<double>(1.0,0.0);
     std::vector<std::complex<double>> vec2(fftSize,std::complex<double>(0.0,0.0));
-    Algorithms::FFT<double> double_engine(fftSize);
-    unsigned int ret = double_engine.sa_fft(vec1, vec2);
-
-    auto ptr = (ret == 0) ? &vec1[0] : &vec2[0];
+    sg14::fft_plan<double> plan(fftSize);
+    auto ptr = sg14::fft(plan, vec1.data(), vec2.data());
 
     std::complex<double> ref;
     unsigned int index;
@@ -60,10 +59,9 @@ TEST(fft, safft_fixed_point)
     fix_vec1[impulseLoc] = cone;
     std::vector <complex> fix_vec2(fftSize, czero);
 
-    Algorithms::FFT<elastic_fixed_point> fix_engine(fftSize);
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
 
-    unsigned int fix_ret = fix_engine.sa_fft(fix_vec1, fix_vec2);
-    auto fix_ptr = (fix_ret == 0) ? &fix_vec1[0] : &fix_vec2[0];
+    auto fix_ptr = sg14::fft(plan, fix_vec1.data(), fix_vec2.data());
 
     std::complex<double> ref;
     unsigned int index;
@@ -94,11 +92,10 @@ TEST(fft, saifft_fixed_point)
     std::vector <complex> fix_vec1(fftSize, cone);
     std::vector <complex> fix_vec2(fftSize, czero);
 
-    Algorithms::FFT<elastic_fixed_point> fix_engine(fftSize);
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
 
     // Stockham autosort FFT using two buffers
-    unsigned int fix_ret = fix_engine.sa_ifft(fix_vec1, fix_vec2);
-    auto fix_ptr = (fix_ret == 0) ? &fix_vec1[0] : &fix_vec2[0];
+    auto fix_ptr = sg14::ifft(plan, fix_vec1.data(), fix_vec2.data());
 
     std::complex<double> refdc = fftSize;
     std::complex<double> ref = 0;
@@ -128,10 +125,10 @@ TEST(fft, ctfft_fixed_point)
     std::vector <complex> fix_vec1(fftSize, czero);
     fix_vec1[impulseLoc] = cone;
 
-    Algorithms::FFT<elastic_fixed_point> fix_engine(fftSize);
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
 
     // In-place FFT
-    fix_engine.ct_fft(fix_vec1);
+    sg14::fft(plan, fix_vec1.data());
 
     std::complex<double> ref;
     unsigned int index;
@@ -160,9 +157,9 @@ TEST(fft, ctifft_fixed_point)
 
     std::vector <complex> fix_vec1(fftSize, cone);
 
-    Algorithms::FFT<elastic_fixed_point> fix_engine(fftSize);
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
 
-    fix_engine.ct_ifft(fix_vec1);
+    sg14::ifft(plan, fix_vec1.data());
 
     std::complex<double> refdc = fftSize;
     std::complex<double> ref = 0;
@@ -192,10 +189,10 @@ TEST(fft, blockfft_fixed_point)
     std::vector <complex> fix_vec1(fftSize, czero);
     fix_vec1[impulseLoc] = cone;
 
-    Algorithms::FFT<elastic_fixed_point> fft_engine(fftSize);
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
 
     // In-place FFT
-    int norm = fft_engine.bf_fft(fix_vec1);
+    int norm = sg14::block_fft(plan, fix_vec1.data());
     double scale = pow(2.0,(double)-norm);
 
     std::complex<double> ref;
@@ -225,9 +222,9 @@ TEST(fft, blockifft_fixed_point)
 
     std::vector <complex> fix_vec1(fftSize, cone);
 
-    Algorithms::FFT<elastic_fixed_point> fix_engine(fftSize);
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
 
-    int norm = fix_engine.bf_ifft(fix_vec1);
+    int norm = sg14::block_ifft(plan, fix_vec1.data());
     double scale = pow(2.0,(double)-norm);
 
     std::complex<double> refdc = fftSize;
@@ -243,3 +240,604 @@ TEST(fft, blockifft_fixed_point)
     std::cout << "Total normalization: " << norm << std::endl;
 }
 
+
+TEST(fft, plan)
+{
+    using fixed_point = sg14::fixed_point<int32_t, -20>;
+    using complex = std::complex<fixed_point>;
+
+    sg14::fft_plan<fixed_point> const plan(8);
+    ASSERT_EQ(8u, plan.size());
+    ASSERT_EQ(3, plan.stages());
+    ASSERT_EQ(complex(1., 0.), plan.twiddle(0));
+    ASSERT_EQ(complex(0., -1.), plan.twiddle(2));
+
+    // a plan is reused by transforms of each kind, in and out of place
+    complex const input[8] = {{1., 0.}, {.5, -.5}, {0., 0.}, {0., 0.}, {0., 0.}, {0., 0.}, {0., 0.}, {-.5, .5}};
+    complex in_place[8];
+    std::copy(std::begin(input), std::end(input), in_place);
+    sg14::fft(plan, in_place);
+
+    complex data[8], work[8];
+    std::copy(std::begin(input), std::end(input), data);
+    auto const out_of_place = sg14::fft(plan, data, work);
+    ASSERT_EQ(work, out_of_place);
+
+    for (unsigned int k = 0; k != 8; ++k) {
+        auto const angle = M_PI*k/4.;
+        auto const expected = std::complex<double>(1., 0.)
+                              +std::complex<double>(.5, -.5)*std::polar(1., -angle)
+                              +std::complex<double>(-.5, .5)*std::polar(1., angle);
+        ASSERT_LT(std::abs((double)in_place[k].real()-expected.real()), 0.00001);
+        ASSERT_LT(std::abs((double)in_place[k].imag()-expected.imag()), 0.00001);
+        ASSERT_EQ(in_place[k], out_of_place[k]);
+    }
+}
+
+// plans of parts which cannot represent 1 saturate the factors of 1 rather than wrapping them to -1
+template<class Rep, int Exponent, class Algorithm>
+void test_q_plan(Algorithm algorithm)
+{
+    using fixed_point = sg14::fixed_point<Rep, Exponent>;
+    using complex = std::complex<fixed_point>;
+    auto const lsb = std::ldexp(1., Exponent);
+
+    sg14::fft_plan<fixed_point> const plan(16);
+    ASSERT_EQ(std::numeric_limits<fixed_point>::max(), plan.twiddle(0).real());
+    ASSERT_EQ(fixed_point(-1), plan.twiddle(4).imag());
+
+    // a pseudo-random signal with parts no greater than 1/32, so that no transformed part is out of range,
+    // transforms as in double precision give or take the truncation of each product
+    std::vector<complex> input(16);
+    unsigned int seed = 1;
+    for (auto& value : input) {
+        seed = seed*1664525u+1013904223u;
+        auto const re = static_cast<int16_t>(seed >> 16)/1048576.;
+        seed = seed*1664525u+1013904223u;
+        auto const im = static_cast<int16_t>(seed >> 16)/1048576.;
+        value = complex(re, im);
+    }
+    for (bool inverse : {false, true}) {
+        auto data = input;
+        if (inverse) {
+            sg14::ifft(plan, data.data(), algorithm);
+        }
+        else {
+            sg14::fft(plan, data.data(), algorithm);
+        }
+        for (unsigned int k = 0; k != 16; ++k) {
+            std::complex<double> expected;
+            for (unsigned int n = 0; n != 16; ++n) {
+                expected += std::complex<double>((double)input[n].real(), (double)input[n].imag())
+                            *std::polar(1., (inverse ? M_PI : -M_PI)*((k*n)%16)/8.);
+            }
+            ASSERT_NEAR((double)data[k].real(), expected.real(), 16*lsb) << "k=" << k << ", inverse=" << inverse;
+            ASSERT_NEAR((double)data[k].imag(), expected.imag(), 16*lsb) << "k=" << k << ", inverse=" << inverse;
+        }
+    }
+
+    sg14::rfft_plan<fixed_point> const real_plan(8);
+    ASSERT_EQ(std::numeric_limits<fixed_point>::max(), real_plan.split_b(2).real());
+
+    // the packed transform of an impulse at index 1 of a real signal
+    std::vector<fixed_point> signal(8, fixed_point(0));
+    signal[1] = .25;
+    std::vector<std::complex<fixed_point>> spectrum(4);
+    sg14::rfft(real_plan, signal.data(), spectrum.data());
+    ASSERT_NEAR((double)spectrum[0].real(), .25, 2*lsb);
+    ASSERT_NEAR((double)spectrum[0].imag(), -.25, 2*lsb);
+    for (unsigned int k = 1; k != 4; ++k) {
+        auto const expected = std::polar(.25, -M_PI*k/4.);
+        ASSERT_NEAR((double)spectrum[k].real(), expected.real(), 2*lsb) << "k=" << k;
+        ASSERT_NEAR((double)spectrum[k].imag(), expected.imag(), 2*lsb) << "k=" << k;
+    }
+}
+
+TEST(fft, plan_q15_q31)
+{
+    test_q_plan<int16_t, -15>(sg14::radix_2);
+    test_q_plan<int16_t, -15>(sg14::radix_4);
+    test_q_plan<int16_t, -15>(sg14::split_radix);
+    test_q_plan<int32_t, -31>(sg14::radix_2);
+    test_q_plan<int32_t, -31>(sg14::radix_4);
+    test_q_plan<int32_t, -31>(sg14::split_radix);
+}
+
+// the in-place algorithms transform a pseudo-random signal like the double-precision radix-2 algorithm
+template<class Algorithm>
+void test_algorithm(Algorithm algorithm)
+{
+    using fixed_point = sg14::fixed_point<int32_t, -30>;
+    using complex = std::complex<fixed_point>;
+
+    for (unsigned int fftSize : {1u, 2u, 4u, 8u, 32u, 64u, 512u, 1u<<13}) {
+        std::vector<std::complex<double>> input(fftSize);
+        unsigned int seed = 1;
+        for (auto& value : input) {
+            seed = seed*1664525u+1013904223u;
+            auto const re = static_cast<int16_t>(seed >> 16)/32768.;
+            seed = seed*1664525u+1013904223u;
+            auto const im = static_cast<int16_t>(seed >> 16)/32768.;
+            value = std::complex<double>(re, im);
+        }
+
+        for (bool inverse : {false, true}) {
+            auto expected = input;
+            sg14::fft_plan<double> const plan_double(fftSize);
+            if (inverse) {
+                sg14::ifft(plan_double, expected.data());
+            }
+            else {
+                sg14::fft(plan_double, expected.data());
+            }
+
+            auto actual = input;
+            if (inverse) {
+                sg14::ifft(plan_double, actual.data(), algorithm);
+            }
+            else {
+                sg14::fft(plan_double, actual.data(), algorithm);
+            }
+            for (unsigned int i = 0; i != fftSize; ++i) {
+                ASSERT_LT(std::abs(actual[i]-expected[i]), 0.000000001) << "N=" << fftSize << ", i=" << i;
+            }
+
+            sg14::fft_plan<fixed_point> const plan(fftSize);
+            std::vector<complex> block(fftSize);
+            for (unsigned int i = 0; i != fftSize; ++i) {
+                block[i] = complex(input[i].real(), input[i].imag());
+            }
+            int const norm = inverse
+                             ? sg14::block_ifft(plan, block.data(), algorithm)
+                             : sg14::block_fft(plan, block.data(), algorithm);
+            double const scale = pow(2.0, (double)-norm);
+            double const tolerance = 0.0000001*fftSize;
+            for (unsigned int i = 0; i != fftSize; ++i) {
+                ASSERT_LT(std::abs((double)block[i].real()*scale-expected[i].real()), tolerance)
+                                            << "N=" << fftSize << ", i=" << i << ", inverse=" << inverse;
+                ASSERT_LT(std::abs((double)block[i].imag()*scale-expected[i].imag()), tolerance)
+                                            << "N=" << fftSize << ", i=" << i << ", inverse=" << inverse;
+            }
+        }
+    }
+}
+
+TEST(fft, radix_4)
+{
+    test_algorithm(sg14::radix_4);
+}
+
+TEST(fft, split_radix)
+{
+    test_algorithm(sg14::split_radix);
+}
+
+TEST(fft, algorithms_fixed_point)
+{
+    unsigned int fftSize = 1<<11;
+    unsigned int impulseLoc = 15;
+
+    using elastic_fixed_point = sg14::elastic_fixed_point<14, 16>;
+    using complex = std::complex<elastic_fixed_point>;
+
+    sg14::fft_plan<elastic_fixed_point> plan(fftSize);
+    std::vector<complex> radix_2(fftSize, complex(0, 0));
+    radix_2[impulseLoc] = complex(1, 0);
+    auto radix_4 = radix_2;
+    auto split_radix = radix_2;
+
+    sg14::fft(plan, radix_2.data());
+    sg14::fft(plan, radix_4.data(), sg14::radix_4);
+    sg14::fft(plan, split_radix.data(), sg14::split_radix);
+    for (unsigned int i = 0; i < fftSize; ++i) {
+        ASSERT_LT(std::abs((double)radix_4[i].real()-(double)radix_2[i].real()), 0.0005);
+        ASSERT_LT(std::abs((double)radix_4[i].imag()-(double)radix_2[i].imag()), 0.0005);
+        ASSERT_LT(std::abs((double)split_radix[i].real()-(double)radix_2[i].real()), 0.0005);
+        ASSERT_LT(std::abs((double)split_radix[i].imag()-(double)radix_2[i].imag()), 0.0005);
+    }
+}
+
+// the vector passes and stages produce the results of the scalar ones, including where parts wrap
+template<class Rep, int Exponent>
+void test_instruction_sets()
+{
+    using fixed_point = sg14::fixed_point<Rep, Exponent>;
+    using complex = std::complex<fixed_point>;
+    using stockham = sg14::_impl::dispatch::registry<sg14::_impl::fp::batch::stockham_key<Rep, Exponent>>;
+    using cooley_tukey = sg14::_impl::dispatch::registry<sg14::_impl::fp::batch::cooley_tukey_key<Rep, Exponent>>;
+
+    for (unsigned int fftSize = 2; fftSize <= 2048; fftSize *= 2) {
+        sg14::fft_plan<fixed_point> const plan(fftSize);
+        std::vector<complex> input(fftSize);
+        unsigned int seed = fftSize;
+        for (unsigned int i = 0; i != fftSize; ++i) {
+            seed = seed*1664525u+1013904223u;
+            auto const re = (i%37<3) ? std::numeric_limits<Rep>::min() : static_cast<Rep>(seed >> 8);
+            seed = seed*1664525u+1013904223u;
+            auto const im = (i%41<2) ? std::numeric_limits<Rep>::min() : static_cast<Rep>(seed >> 8);
+            input[i] = complex(fixed_point::from_data(re), fixed_point::from_data(im));
+        }
+
+        for (auto set : {sg14::instruction_set::sse4_1, sg14::instruction_set::avx2,
+                         sg14::instruction_set::avx512}) {
+            if (set > sg14::supported_instruction_set()) {
+                continue;
+            }
+            for (bool inverse : {false, true}) {
+                for (int q = 1; q <= plan.stages(); ++q) {
+                    std::vector<complex> expected(fftSize), actual(fftSize);
+                    stockham::select(sg14::instruction_set::scalar)(
+                            &plan.twiddle(0), fftSize, q, inverse, input.data(), expected.data());
+                    stockham::select(set)(&plan.twiddle(0), fftSize, q, inverse, input.data(), actual.data());
+                    for (unsigned int i = 0; i != fftSize; ++i) {
+                        ASSERT_EQ(expected[i], actual[i]) << sg14::instruction_set_name(set) << ", N=" << fftSize
+                                                          << ", q=" << q << ", inverse=" << inverse << ", i=" << i;
+                    }
+
+                    expected = input;
+                    actual = input;
+                    cooley_tukey::select(sg14::instruction_set::scalar)(
+                            &plan.twiddle(0), fftSize, q, inverse, 0, fftSize/2, expected.data());
+                    cooley_tukey::select(set)(&plan.twiddle(0), fftSize, q, inverse, 0, fftSize/2, actual.data());
+                    for (unsigned int i = 0; i != fftSize; ++i) {
+                        ASSERT_EQ(expected[i], actual[i]) << sg14::instruction_set_name(set) << ", N=" << fftSize
+                                                          << ", q=" << q << ", inverse=" << inverse << ", i=" << i;
+                    }
+
+                    // the butterflies of the stage in eight parts, as divided among threads
+                    if (fftSize >= 16) {
+                        actual = input;
+                        for (unsigned int part = 0; part != 8; ++part) {
+                            cooley_tukey::select(set)(&plan.twiddle(0), fftSize, q, inverse,
+                                    part*fftSize/16, (part+1)*fftSize/16, actual.data());
+                        }
+                        for (unsigned int i = 0; i != fftSize; ++i) {
+                            ASSERT_EQ(expected[i], actual[i]) << sg14::instruction_set_name(set) << ", N=" << fftSize
+                                                              << ", q=" << q << ", inverse=" << inverse
+                                                              << ", parts=8, i=" << i;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(fft, instruction_sets)
+{
+    test_instruction_sets<int16_t, -14>();
+    test_instruction_sets<int16_t, -15>();
+    test_instruction_sets<int16_t, 0>();
+    test_instruction_sets<int32_t, -30>();
+    test_instruction_sets<int32_t, -31>();
+}
+
+// the transforms made with the vector passes and stages of each instruction set
+// are those calculated in double precision, give or take the truncation of each product;
+// that is up to an LSB per value per stage, which sums to up to fftSize LSBs
+template<class Rep, int Exponent>
+void test_instruction_set_accuracy()
+{
+    using fixed_point = sg14::fixed_point<Rep, Exponent>;
+    using complex = std::complex<fixed_point>;
+    using stockham = sg14::_impl::dispatch::registry<sg14::_impl::fp::batch::stockham_key<Rep, Exponent>>;
+    using cooley_tukey = sg14::_impl::dispatch::registry<sg14::_impl::fp::batch::cooley_tukey_key<Rep, Exponent>>;
+
+    for (unsigned int fftSize : {8u, 64u, 1024u}) {
+        sg14::fft_plan<fixed_point> const plan(fftSize);
+        auto const tolerance = std::ldexp(1., Exponent)*fftSize;
+
+        // parts no greater than 1/(2*fftSize) so that no transformed part is out of range
+        std::vector<complex> input(fftSize);
+        unsigned int seed = fftSize;
+        for (auto& value : input) {
+            seed = seed*1664525u+1013904223u;
+            auto const re = static_cast<int16_t>(seed >> 16)/65536./fftSize;
+            seed = seed*1664525u+1013904223u;
+            auto const im = static_cast<int16_t>(seed >> 16)/65536./fftSize;
+            value = complex(re, im);
+        }
+
+        for (bool inverse : {false, true}) {
+            std::vector<std::complex<double>> expected(fftSize);
+            for (unsigned int k = 0; k != fftSize; ++k) {
+                for (unsigned int n = 0; n != fftSize; ++n) {
+                    auto const angle = (inverse ? 2. : -2.)*M_PI*((k*n)%fftSize)/fftSize;
+                    expected[k] += std::complex<double>((double)input[n].real(), (double)input[n].imag())
+                                   *std::polar(1., angle);
+                }
+            }
+
+            for (auto set : {sg14::instruction_set::scalar, sg14::instruction_set::sse4_1,
+                             sg14::instruction_set::avx2, sg14::instruction_set::avx512}) {
+                if (set > sg14::supported_instruction_set()) {
+                    continue;
+                }
+
+                std::vector<complex> autosorted(input), work(fftSize);
+                for (int q = 1; q <= plan.stages(); ++q) {
+                    stockham::select(set)(&plan.twiddle(0), fftSize, q, inverse, autosorted.data(), work.data());
+                    std::swap(autosorted, work);
+                }
+
+                std::vector<complex> in_place(input);
+                sg14::_impl::fft::reorder(in_place.data(), fftSize);
+                for (int q = 1; q <= plan.stages(); ++q) {
+                    cooley_tukey::select(set)(&plan.twiddle(0), fftSize, q, inverse, 0, fftSize/2, in_place.data());
+                }
+
+                for (unsigned int k = 0; k != fftSize; ++k) {
+                    for (auto const& actual : {autosorted[k], in_place[k]}) {
+                        ASSERT_NEAR((double)actual.real(), expected[k].real(), tolerance)
+                                                    << sg14::instruction_set_name(set) << ", N=" << fftSize
+                                                    << ", inverse=" << inverse << ", k=" << k;
+                        ASSERT_NEAR((double)actual.imag(), expected[k].imag(), tolerance)
+                                                    << sg14::instruction_set_name(set) << ", N=" << fftSize
+                                                    << ", inverse=" << inverse << ", k=" << k;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(fft, instruction_set_accuracy)
+{
+    test_instruction_set_accuracy<int16_t, -15>();
+    test_instruction_set_accuracy<int32_t, -31>();
+}
+
+// a pseudo-random real signal and its transform calculated one value at a time
+std::vector<double> real_signal(unsigned int fftSize)
+{
+    std::vector<double> signal(fftSize);
+    unsigned int seed = fftSize;
+    for (auto& value : signal) {
+        seed = seed*1664525u+1013904223u;
+        value = static_cast<int16_t>(seed >> 16)/65536.;
+    }
+    return signal;
+}
+
+std::vector<std::complex<double>> dft(const std::vector<double>& signal)
+{
+    auto const fftSize = signal.size();
+    std::vector<std::complex<double>> transform(fftSize);
+    for (unsigned int k = 0; k != fftSize; ++k) {
+        for (unsigned int n = 0; n != fftSize; ++n) {
+            transform[k] += signal[n]*std::polar(1., -M_PI*2.0*((k*n)%fftSize)/fftSize);
+        }
+    }
+    return transform;
+}
+
+// the packed output of rfft compared with the transform
+template<class T>
+void expect_packed(const std::vector<std::complex<double>>& expected, const std::vector<std::complex<T>>& actual,
+        double scale, double tolerance)
+{
+    auto const half = actual.size();
+    ASSERT_LT(std::abs((double)actual[0].real()*scale-expected[0].real()), tolerance);
+    ASSERT_LT(std::abs((double)actual[0].imag()*scale-expected[half].real()), tolerance);
+    for (unsigned int k = 1; k != half; ++k) {
+        ASSERT_LT(std::abs((double)actual[k].real()*scale-expected[k].real()), tolerance) << "k=" << k;
+        ASSERT_LT(std::abs((double)actual[k].imag()*scale-expected[k].imag()), tolerance) << "k=" << k;
+    }
+}
+
+TEST(fft, rfft_double)
+{
+    for (unsigned int fftSize : {2u, 4u, 8u, 64u, 1024u}) {
+        auto const signal = real_signal(fftSize);
+        auto const expected = dft(signal);
+
+        sg14::rfft_plan<double> const plan(fftSize);
+        ASSERT_EQ(fftSize, plan.size());
+        ASSERT_EQ(fftSize/2, plan.half().size());
+        std::vector<std::complex<double>> spectrum(fftSize/2);
+        sg14::rfft(plan, signal.data(), spectrum.data());
+        expect_packed(expected, spectrum, 1., 0.000000001);
+
+        std::vector<double> output(fftSize);
+        sg14::irfft(plan, spectrum.data(), output.data());
+        for (unsigned int n = 0; n != fftSize; ++n) {
+            ASSERT_LT(std::abs(output[n]-signal[n]*(fftSize/2)), 0.000000001) << "N=" << fftSize << ", n=" << n;
+        }
+    }
+}
+
+TEST(fft, rfft_fixed_point)
+{
+    using fixed_point = sg14::fixed_point<int32_t, -20>;
+
+    unsigned int fftSize = 256;
+    auto const signal = real_signal(fftSize);
+    auto const expected = dft(signal);
+
+    std::vector<fixed_point> input(signal.begin(), signal.end());
+    sg14::rfft_plan<fixed_point> const plan(fftSize);
+    std::vector<std::complex<fixed_point>> spectrum(fftSize/2);
+    sg14::rfft(plan, input.data(), spectrum.data());
+    expect_packed(expected, spectrum, 1., 0.001);
+
+    std::vector<fixed_point> output(fftSize);
+    sg14::irfft(plan, spectrum.data(), output.data());
+    for (unsigned int n = 0; n != fftSize; ++n) {
+        ASSERT_LT(std::abs((double)output[n]-signal[n]*(fftSize/2)), 0.1) << "n=" << n;
+    }
+}
+
+TEST(fft, block_rfft_fixed_point)
+{
+    using fixed_point = sg14::fixed_point<int16_t, -14>;
+
+    for (unsigned int fftSize : {2u, 16u, 1024u}) {
+        auto const signal = real_signal(fftSize);
+        auto const expected = dft(signal);
+
+        std::vector<fixed_point> input(signal.begin(), signal.end());
+        sg14::rfft_plan<fixed_point> const plan(fftSize);
+        std::vector<std::complex<fixed_point>> spectrum(fftSize/2);
+        int norm = sg14::block_rfft(plan, input.data(), spectrum.data());
+        expect_packed(expected, spectrum, pow(2.0, (double)-norm), 0.0005*fftSize);
+
+        std::vector<fixed_point> output(fftSize);
+        // the spectrum is the transform multiplied by 2^norm
+        norm += sg14::block_irfft(plan, spectrum.data(), output.data());
+        for (unsigned int n = 0; n != fftSize; ++n) {
+            ASSERT_LT(std::abs((double)output[n]*pow(2.0, (double)-norm)/(fftSize/2)-signal[n]), 0.002+0.00001*fftSize)
+                                        << "N=" << fftSize << ", n=" << n;
+        }
+    }
+}
+
+// the transforms of runs of values divided among threads are those of each run
+TEST(fft, batch)
+{
+    using fixed_point = sg14::fixed_point<int16_t, -14>;
+    using complex = std::complex<fixed_point>;
+
+    unsigned int const fftSize = 256;
+    unsigned int const count = 13;
+    sg14::fft_plan<fixed_point> const plan(fftSize);
+    std::vector<complex> input(fftSize*count);
+    unsigned int seed = 1;
+    for (auto& value : input) {
+        seed = seed*1664525u+1013904223u;
+        auto const re = static_cast<int16_t>(seed >> 18);
+        seed = seed*1664525u+1013904223u;
+        auto const im = static_cast<int16_t>(seed >> 18);
+        value = complex(fixed_point::from_data(re), fixed_point::from_data(im));
+    }
+
+    for (unsigned int threads : {1u, 3u, 4u, 20u}) {
+        std::vector<complex> stockham(input), in_place(input), block(input), expected(input);
+        std::vector<complex> work(fftSize*threads);
+        std::vector<int> exponents(count);
+        sg14::batch_fft(plan, stockham.data(), work.data(), count, threads);
+        sg14::batch_ifft(plan, in_place.data(), count, threads, sg14::radix_4);
+        sg14::batch_block_fft(plan, block.data(), count, exponents.data(), threads);
+
+        for (unsigned int i = 0; i != count; ++i) {
+            auto const output = sg14::fft(plan, expected.data()+i*fftSize, work.data());
+            for (unsigned int n = 0; n != fftSize; ++n) {
+                ASSERT_EQ(output[n], stockham[i*fftSize+n]) << "threads=" << threads << ", i=" << i << ", n=" << n;
+            }
+
+            std::vector<complex> run(input.begin()+i*fftSize, input.begin()+(i+1)*fftSize);
+            sg14::ifft(plan, run.data(), sg14::radix_4);
+            for (unsigned int n = 0; n != fftSize; ++n) {
+                ASSERT_EQ(run[n], in_place[i*fftSize+n]) << "threads=" << threads << ", i=" << i << ", n=" << n;
+            }
+
+            run.assign(input.begin()+i*fftSize, input.begin()+(i+1)*fftSize);
+            ASSERT_EQ(sg14::block_fft(plan, run.data()), exponents[i]) << "threads=" << threads << ", i=" << i;
+            for (unsigned int n = 0; n != fftSize; ++n) {
+                ASSERT_EQ(run[n], block[i*fftSize+n]) << "threads=" << threads << ", i=" << i << ", n=" << n;
+            }
+        }
+    }
+}
+
+// the transform with its stages divided among threads is that made by one thread
+template<class T>
+void test_parallel(unsigned int fftSize, unsigned int threads)
+{
+    using complex = std::complex<T>;
+
+    sg14::fft_plan<T> const plan(fftSize);
+    std::vector<complex> input(fftSize);
+    unsigned int seed = fftSize;
+    for (auto& value : input) {
+        seed = seed*1664525u+1013904223u;
+        auto const re = static_cast<int16_t>(seed >> 16)/65536.;
+        seed = seed*1664525u+1013904223u;
+        auto const im = static_cast<int16_t>(seed >> 16)/65536.;
+        value = complex(static_cast<T>(re), static_cast<T>(im));
+    }
+
+    for (bool inverse : {false, true}) {
+        std::vector<complex> expected(input), actual(input);
+        if (inverse) {
+            sg14::ifft(plan, expected.data());
+            sg14::parallel_ifft(plan, actual.data(), threads);
+        }
+        else {
+            sg14::fft(plan, expected.data());
+            sg14::parallel_fft(plan, actual.data(), threads);
+        }
+        for (unsigned int i = 0; i != fftSize; ++i) {
+            ASSERT_EQ(expected[i], actual[i]) << "N=" << fftSize << ", threads=" << threads
+                                              << ", inverse=" << inverse << ", i=" << i;
+        }
+    }
+}
+
+TEST(fft, parallel)
+{
+    test_parallel<sg14::fixed_point<int32_t, -30>>(1 << 18, 4);
+    test_parallel<sg14::fixed_point<int32_t, -30>>(1 << 18, 3);
+    test_parallel<sg14::fixed_point<int16_t, -14>>(1 << 17, 8);
+    test_parallel<sg14::fixed_point<int16_t, -14>>(1024, 4);
+    test_parallel<double>(1 << 18, 4);
+}
+
+// one pool divides successive batches and parallel transforms as threads started by each call do
+TEST(fft, thread_pool)
+{
+    using fixed_point = sg14::fixed_point<int32_t, -30>;
+    using complex = std::complex<fixed_point>;
+
+    sg14::fft_thread_pool pool(4);
+    ASSERT_EQ(4u, pool.size());
+
+    unsigned int const fftSize = 1 << 17;
+    unsigned int const count = 7;
+    sg14::fft_plan<fixed_point> const plan(fftSize);
+    std::vector<complex> input(fftSize*count);
+    unsigned int seed = 3;
+    for (auto& value : input) {
+        seed = seed*1664525u+1013904223u;
+        auto const re = static_cast<int32_t>(seed) >> 4;
+        seed = seed*1664525u+1013904223u;
+        auto const im = static_cast<int32_t>(seed) >> 4;
+        value = complex(fixed_point::from_data(re), fixed_point::from_data(im));
+    }
+
+    for (int repeat = 0; repeat!=3; ++repeat) {
+        std::vector<complex> pooled(input), spawned(input);
+        std::vector<complex> work(fftSize*pool.size());
+        sg14::batch_fft(plan, pooled.data(), work.data(), count, pool);
+        sg14::batch_fft(plan, spawned.data(), work.data(), count, pool.size());
+        ASSERT_TRUE(pooled==spawned) << "repeat=" << repeat;
+
+        sg14::batch_ifft(plan, pooled.data(), count, pool, sg14::split_radix);
+        sg14::batch_ifft(plan, spawned.data(), count, pool.size(), sg14::split_radix);
+        ASSERT_TRUE(pooled==spawned) << "repeat=" << repeat;
+
+        std::vector<int> pooled_exponents(count), spawned_exponents(count);
+        sg14::batch_block_fft(plan, pooled.data(), count, pooled_exponents.data(), pool);
+        sg14::batch_block_fft(plan, spawned.data(), count, spawned_exponents.data(), pool.size());
+        ASSERT_TRUE(pooled==spawned) << "repeat=" << repeat;
+        ASSERT_TRUE(pooled_exponents==spawned_exponents) << "repeat=" << repeat;
+
+        for (unsigned int i = 0; i!=count; ++i) {
+            sg14::parallel_fft(plan, pooled.data()+i*fftSize, pool);
+            sg14::parallel_fft(plan, spawned.data()+i*fftSize, pool.size());
+        }
+        ASSERT_TRUE(pooled==spawned) << "repeat=" << repeat;
+    }
+
+#if defined(SG14_EXCEPTIONS_ENABLED)
+    // an exception thrown by a worker is rethrown to the caller, after which the pool is still usable
+    ASSERT_THROW(pool.run(4, [](std::size_t band) {
+        if (band==2) {
+            throw std::runtime_error("band 2");
+        }
+    }), std::runtime_error);
+
+    std::vector<int> bands(4);
+    pool.run(4, [&](std::size_t band) { bands[band] = static_cast<int>(band)+1; });
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4}), bands);
+#endif
+}
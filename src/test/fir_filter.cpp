@@ -0,0 +1,145 @@
+
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/fir_filter.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    using sg14::fixed_point;
+
+    using q15 = fixed_point<std::int16_t, -15>;
+    using q30 = fixed_point<std::int64_t, -30>;
+
+    static_assert(std::is_same<sg14::fir_filter<q15, q15, 32>::accumulator_type, q30>::value,
+            "sg14::fir_filter test failed");
+    static_assert(std::is_same<sg14::fir_filter<q15, q15, 1>::accumulator_type, fixed_point<std::int32_t, -30>>::value,
+            "sg14::fir_filter test failed");
+
+    constexpr std::size_t block_size = 1024;
+
+    // a block of samples of a pseudo-random signal including runs of the lowest value
+    std::vector<q15> signal()
+    {
+        auto samples = std::vector<q15>{};
+        auto seed = 1u;
+        for (auto i = std::size_t{0}; i!=block_size; ++i) {
+            seed = seed*1664525u+1013904223u;
+            samples.push_back((i%100<8)
+                              ? std::numeric_limits<q15>::lowest()
+                              : q15::from_data(static_cast<std::int16_t>(seed >> 16)));
+        }
+        return samples;
+    }
+
+    template<std::size_t Taps>
+    void make_coefficients(q15 (&coefficients)[Taps])
+    {
+        for (auto tap = std::size_t{0}; tap!=Taps; ++tap) {
+            coefficients[tap] = q15::from_data(static_cast<std::int16_t>((tap%3==0) ? -32768 : 977*tap-15000));
+        }
+    }
+
+    // direct convolution of the input, with zeros before it, and the coefficients
+    template<std::size_t Taps>
+    std::vector<std::int64_t> convolve(const std::vector<q15>& input, const q15 (&coefficients)[Taps])
+    {
+        auto output = std::vector<std::int64_t>(input.size());
+        for (auto n = std::size_t{0}; n!=input.size(); ++n) {
+            for (auto k = std::size_t{0}; k!=Taps && k<=n; ++k) {
+                output[n] += std::int64_t{coefficients[k].data()}*input[n-k].data();
+            }
+        }
+        return output;
+    }
+
+    template<std::size_t Taps>
+    void test_fir_filter()
+    {
+        q15 coefficients[Taps];
+        make_coefficients(coefficients);
+        auto const input = signal();
+        auto const expected = convolve(input, coefficients);
+
+        auto filter = sg14::fir_filter<q15, q15, Taps>{coefficients};
+        auto output = std::vector<q30>(block_size);
+        ASSERT_EQ(output.data()+output.size(), filter.process(input.data(), input.data()+input.size(), output.data()));
+        for (auto n = std::size_t{0}; n!=block_size; ++n) {
+            ASSERT_EQ(expected[n], output[n].data()) << "Taps=" << Taps << ", n=" << n;
+        }
+
+        filter.reset();
+        for (auto n = std::size_t{0}; n!=block_size; ++n) {
+            ASSERT_EQ(expected[n], filter.process(input[n]).data()) << "Taps=" << Taps << ", n=" << n;
+        }
+    }
+
+    TEST(fir_filter, process)
+    {
+        test_fir_filter<1>();
+        test_fir_filter<7>();
+        test_fir_filter<32>();
+        test_fir_filter<67>();
+    }
+
+    TEST(fir_filter, output_conversion)
+    {
+        q15 const coefficients[] = {.5, .25};
+        auto filter = sg14::fir_filter<q15, q15, 2>{coefficients};
+        q15 const input[] = {.5, -.5, .25, 0.};
+        q15 output[4];
+        filter.process(std::begin(input), std::end(input), std::begin(output));
+        EXPECT_EQ(.25, output[0]);
+        EXPECT_EQ(-.125, output[1]);
+        EXPECT_EQ(0., output[2]);
+        EXPECT_EQ(.0625, output[3]);
+    }
+
+    template<std::size_t Taps, std::size_t Interpolation, std::size_t Decimation>
+    void test_polyphase_fir_filter()
+    {
+        q15 coefficients[Taps];
+        make_coefficients(coefficients);
+        auto const input = signal();
+
+        // zeros inserted after each sample
+        auto upsampled = std::vector<q15>(input.size()*Interpolation, q15{0});
+        for (auto n = std::size_t{0}; n!=input.size(); ++n) {
+            upsampled[n*Interpolation] = input[n];
+        }
+        auto const filtered = convolve(upsampled, coefficients);
+
+        auto filter = sg14::polyphase_fir_filter<q15, q15, Taps, Interpolation, Decimation>{coefficients};
+        auto output = std::vector<q30>((Interpolation*block_size+Decimation-1)/Decimation+1);
+
+        // in uneven blocks to exercise the continuation of the phase between calls
+        auto const middle = input.data()+block_size/3;
+        auto const end = filter.process(middle, input.data()+input.size(),
+                filter.process(input.data(), middle, output.data()));
+        ASSERT_EQ(static_cast<std::ptrdiff_t>((filtered.size()+Decimation-1)/Decimation), end-output.data());
+        for (auto m = std::size_t{0}; m*Decimation<filtered.size(); ++m) {
+            ASSERT_EQ(filtered[m*Decimation], output[m].data())
+                                        << "Interpolation=" << Interpolation << ", Decimation=" << Decimation
+                                        << ", m=" << m;
+        }
+    }
+
+    TEST(fir_filter, polyphase)
+    {
+        test_polyphase_fir_filter<32, 1, 4>();
+        test_polyphase_fir_filter<32, 4, 1>();
+        test_polyphase_fir_filter<48, 3, 2>();
+        test_polyphase_fir_filter<30, 2, 3>();
+
+        static_assert(std::is_same<sg14::decimating_fir_filter<q15, q15, 32, 4>,
+                sg14::polyphase_fir_filter<q15, q15, 32, 1, 4>>::value, "sg14::decimating_fir_filter test failed");
+        static_assert(std::is_same<sg14::interpolating_fir_filter<q15, q15, 32, 4>::accumulator_type,
+                q30>::value, "sg14::interpolating_fir_filter test failed");
+    }
+}
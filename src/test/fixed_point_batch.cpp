@@ -0,0 +1,478 @@
+
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/batch.h>
+#include <sg14/auxiliary/precise_integer.h>
+#include <sg14/auxiliary/safe_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+    using sg14::fixed_point;
+    using sg14::instruction_set;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // dispatch
+
+    TEST(fixed_point_batch, select_instruction_set)
+    {
+        EXPECT_STREQ("avx2", sg14::instruction_set_name(instruction_set::avx2));
+
+        using sg14::_impl::dispatch::limit_instruction_set;
+        EXPECT_EQ(instruction_set::avx2, limit_instruction_set(nullptr, instruction_set::avx2));
+        EXPECT_EQ(instruction_set::avx2, limit_instruction_set("", instruction_set::avx2));
+        EXPECT_EQ(instruction_set::avx2, limit_instruction_set("avx512", instruction_set::avx2));
+        EXPECT_EQ(instruction_set::sse4_1, limit_instruction_set("sse4_1", instruction_set::avx2));
+        EXPECT_EQ(instruction_set::scalar, limit_instruction_set("scalar", instruction_set::avx512));
+
+        EXPECT_LE(sg14::selected_instruction_set(), sg14::supported_instruction_set());
+    }
+
+    int scalar_entry() { return 0; }
+    int sse4_1_entry() { return 1; }
+
+    TEST(fixed_point_batch, table)
+    {
+        auto const entries = sg14::_impl::dispatch::table<int()>{{&scalar_entry, &sse4_1_entry, nullptr, nullptr}};
+        EXPECT_EQ(0, entries.select(instruction_set::scalar)());
+        EXPECT_EQ(1, entries.select(instruction_set::sse4_1)());
+        EXPECT_EQ(1, entries.select(instruction_set::avx512)());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // vector kernels
+
+    // every value of an 8- or 16-bit rep or an even sweep of a 32-bit rep;
+    // the odd number of values exercises the scalar remainder of the vector kernels
+    template<class Fixed>
+    std::vector<Fixed> sweep()
+    {
+        using rep = typename Fixed::rep;
+        auto const step = (sizeof(rep)>2) ? (std::int64_t{1} << 16)+1 : std::int64_t{1};
+        auto values = std::vector<Fixed>{};
+        for (auto r = std::int64_t{std::numeric_limits<rep>::min()};
+             r<=std::int64_t{std::numeric_limits<rep>::max()}; r += step) {
+            values.push_back(Fixed::from_data(static_cast<rep>(r)));
+        }
+        if (values.size()%2==0) {
+            values.pop_back();
+        }
+        return values;
+    }
+
+    // the result of each instruction set is identical to that of the scalar kernel
+    template<class Kernel, class Fixed>
+    void test_kernel()
+    {
+        using sg14::_impl::fp::batch::transform;
+        auto const input = sweep<Fixed>();
+        auto expected = std::vector<Fixed>(input.size());
+        transform<Kernel>(instruction_set::scalar, input.data(), input.data()+input.size(), expected.data());
+
+        for (auto set : {instruction_set::sse4_1, instruction_set::avx2, instruction_set::avx512}) {
+            if (set>sg14::supported_instruction_set()) {
+                continue;
+            }
+
+            auto actual = std::vector<Fixed>(input.size());
+            auto end = transform<Kernel>(set, input.data(), input.data()+input.size(), actual.data());
+            ASSERT_EQ(actual.data()+actual.size(), end);
+            for (auto i = std::size_t{0}; i!=input.size(); ++i) {
+                ASSERT_EQ(expected[i].data(), actual[i].data())
+                                            << "instruction set " << static_cast<int>(set)
+                                            << ", input " << static_cast<std::int64_t>(input[i].data());
+            }
+        }
+    }
+
+    template<class Fixed>
+    void test_kernels()
+    {
+        using namespace sg14::_impl::fp::batch;
+        test_kernel<abs_kernel, Fixed>();
+        test_kernel<sqrt_kernel, Fixed>();
+        test_kernel<exp2_kernel, Fixed>();
+        test_kernel<log2_kernel, Fixed>();
+        test_kernel<sin_kernel, Fixed>();
+        test_kernel<cos_kernel, Fixed>();
+    }
+
+    TEST(fixed_point_batch, int8)
+    {
+        test_kernels<fixed_point<std::int8_t, -4>>();
+        test_kernels<fixed_point<std::uint8_t, -3>>();
+    }
+
+    TEST(fixed_point_batch, int16)
+    {
+        test_kernels<fixed_point<std::int16_t, -12>>();
+        test_kernels<fixed_point<std::int16_t, -15>>();
+        test_kernels<fixed_point<std::uint16_t, -16>>();
+    }
+
+    TEST(fixed_point_batch, int32)
+    {
+        test_kernels<fixed_point<std::int32_t, -16>>();
+        test_kernels<fixed_point<std::int32_t, -24>>();
+        test_kernels<fixed_point<std::int32_t, -31>>();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // batch math functions
+
+    TEST(fixed_point_batch, functions)
+    {
+        using fp = fixed_point<std::int16_t, -12>;
+        auto const input = std::vector<fp>{-8, -2, -.5, 0, .25, 1, 2, 4, 7.5};
+        auto output = std::vector<fp>(input.size());
+        auto const first = input.data();
+        auto const last = input.data()+input.size();
+
+        for (auto i = std::size_t{0}; i!=input.size(); ++i) {
+            sg14::abs(first, last, output.data());
+            EXPECT_EQ(output[i], (input[i]==-8) ? fp::from_data(32767) : fp{abs(input[i])});
+
+            sg14::sqrt(first, last, output.data());
+            EXPECT_EQ(output[i], (input[i]<0) ? fp{0} : sqrt(input[i]));
+
+            sg14::exp2(first, last, output.data());
+            EXPECT_EQ(output[i], (input[i]>=3) ? std::numeric_limits<fp>::max() : exp2(input[i]));
+
+            sg14::log2(first, last, output.data());
+            EXPECT_EQ(output[i], (input[i]<=0) ? std::numeric_limits<fp>::lowest() : log2(input[i]));
+
+            sg14::sin(first, last, output.data());
+            EXPECT_EQ(output[i], sin(input[i]));
+
+            sg14::cos(first, last, output.data());
+            EXPECT_EQ(output[i], cos(input[i]));
+        }
+    }
+
+    TEST(fixed_point_batch, in_place)
+    {
+        using fp = fixed_point<std::int32_t, -16>;
+        auto values = std::vector<fp>{0, .5, 1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5, 5};
+        auto expected = values;
+        for (auto& value : expected) {
+            value = sin(value);
+        }
+
+        EXPECT_EQ(values.data()+values.size(),
+                sg14::sin(values.data(), values.data()+values.size(), values.data()));
+        EXPECT_EQ(expected, values);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // conversion
+
+    // values spanning the range of Fixed, and beyond it if Saturate, including exact halves;
+    // without saturation, the conversion of halves which round beyond the range is unspecified
+    template<class Float, class Fixed, bool Saturate>
+    std::vector<Float> conversion_inputs()
+    {
+        using rep = typename Fixed::rep;
+        auto const scale = std::ldexp(1., Fixed::exponent);
+        auto const lowest = static_cast<double>(std::numeric_limits<rep>::lowest())*scale;
+        auto const max = static_cast<double>(std::numeric_limits<rep>::max())*scale;
+        auto const first = Saturate ? lowest*2-1 : lowest;
+        auto const last = Saturate ? max*2+1 : max;
+
+        auto values = std::vector<Float>{};
+        for (auto i = 0; i!=1001; ++i) {
+            auto const value = static_cast<Float>(first+(last-first)*i/1000);
+            if (Saturate || (value>=lowest && value<=max)) {
+                values.push_back(value);
+                auto const half = static_cast<Float>((std::floor(value/scale)+.5)*scale);
+                if (Saturate || static_cast<double>(half)<max+scale/2) {
+                    values.push_back(half);
+                }
+            }
+        }
+        if (Saturate) {
+            values.push_back(std::numeric_limits<Float>::quiet_NaN());
+            values.push_back(std::numeric_limits<Float>::infinity());
+            values.push_back(-std::numeric_limits<Float>::infinity());
+        }
+        return values;
+    }
+
+    template<class Float, class Fixed, bool Saturate, bool Round>
+    void test_to_fixed()
+    {
+        using sg14::_impl::fp::batch::convert;
+        auto const input = conversion_inputs<Float, Fixed, Saturate>();
+        auto expected = std::vector<Fixed>(input.size());
+        convert<Saturate, Round>(instruction_set::scalar, input.data(), input.data()+input.size(), expected.data());
+
+        for (auto set : {instruction_set::sse4_1, instruction_set::avx2, instruction_set::avx512}) {
+            if (set>sg14::supported_instruction_set()) {
+                continue;
+            }
+
+            auto actual = std::vector<Fixed>(input.size());
+            auto end = convert<Saturate, Round>(set, input.data(), input.data()+input.size(), actual.data());
+            ASSERT_EQ(actual.data()+actual.size(), end);
+            for (auto i = std::size_t{0}; i!=input.size(); ++i) {
+                ASSERT_EQ(expected[i].data(), actual[i].data())
+                                            << "instruction set " << static_cast<int>(set) << ", input " << input[i];
+            }
+        }
+    }
+
+    template<class Float, class Fixed>
+    void test_to_float()
+    {
+        using sg14::_impl::fp::batch::convert;
+        auto const input = sweep<Fixed>();
+        auto expected = std::vector<Float>(input.size());
+        convert(instruction_set::scalar, input.data(), input.data()+input.size(), expected.data());
+
+        for (auto set : {instruction_set::sse4_1, instruction_set::avx2, instruction_set::avx512}) {
+            if (set>sg14::supported_instruction_set()) {
+                continue;
+            }
+
+            auto actual = std::vector<Float>(input.size());
+            auto end = convert(set, input.data(), input.data()+input.size(), actual.data());
+            ASSERT_EQ(actual.data()+actual.size(), end);
+            ASSERT_EQ(expected, actual) << "instruction set " << static_cast<int>(set);
+        }
+    }
+
+    template<class Float, class Fixed>
+    void test_conversions()
+    {
+        test_to_fixed<Float, Fixed, false, false>();
+        test_to_fixed<Float, Fixed, false, true>();
+        test_to_fixed<Float, Fixed, true, false>();
+        test_to_fixed<Float, Fixed, true, true>();
+        test_to_float<Float, Fixed>();
+    }
+
+    template<class Fixed>
+    void test_conversions()
+    {
+        test_conversions<float, Fixed>();
+        test_conversions<double, Fixed>();
+    }
+
+    TEST(fixed_point_batch, convert)
+    {
+        test_conversions<fixed_point<std::int8_t, -4>>();
+        test_conversions<fixed_point<std::uint8_t, 0>>();
+        test_conversions<fixed_point<std::int16_t, -12>>();
+        test_conversions<fixed_point<std::uint16_t, -16>>();
+        test_conversions<fixed_point<std::int16_t, 4>>();
+        test_conversions<fixed_point<std::int32_t, -16>>();
+        test_conversions<fixed_point<std::int32_t, 0>>();
+        test_conversions<fixed_point<std::uint32_t, -8>>();
+        test_conversions<fixed_point<std::uint32_t, 0>>();
+    }
+
+    TEST(fixed_point_batch, convert_functions)
+    {
+        using fp = fixed_point<std::int16_t, -8>;
+        auto const input = std::vector<float>{
+                -129.f, -.5f, -.00390625f*1.5f, .00390625f*.5f, .75f, 127.99f, 300.f,
+                std::numeric_limits<float>::quiet_NaN()};
+        auto const first = input.data();
+        auto const last = first+input.size();
+        auto output = std::vector<fp>(input.size());
+
+        // without saturation, values out of range are unspecified
+        sg14::convert(first+1, last-3, output.data()+1);
+        EXPECT_EQ((std::vector<fp>{-.5, fp::from_data(-1), 0, .75}),
+                std::vector<fp>(output.begin()+1, output.begin()+5));
+
+        EXPECT_EQ(output.data()+output.size(), sg14::convert(sg14::saturated_overflow, first, last, output.data()));
+        EXPECT_EQ((std::vector<fp>{
+                std::numeric_limits<fp>::lowest(), -.5, fp::from_data(-1), 0, .75, fp::from_data(32765),
+                std::numeric_limits<fp>::max(), 0}), output);
+
+        sg14::convert(sg14::saturated_overflow, sg14::closest_rounding_tag{}, first, last, output.data());
+        EXPECT_EQ((std::vector<fp>{
+                std::numeric_limits<fp>::lowest(), -.5, fp::from_data(-2), fp::from_data(1), .75,
+                fp::from_data(32765), std::numeric_limits<fp>::max(), 0}), output);
+
+        auto round_trip = std::vector<float>(input.size());
+        EXPECT_EQ(round_trip.data()+round_trip.size(),
+                sg14::convert(output.data(), output.data()+output.size(), round_trip.data()));
+        EXPECT_EQ(-.5f, round_trip[1]);
+        EXPECT_EQ(.75f, round_trip[4]);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // arithmetic
+
+    template<class Rep, int Exponent>
+    using saturated = fixed_point<sg14::safe_integer<Rep, sg14::saturated_overflow_tag>, Exponent>;
+
+    // every pairing of a range of values including the extremes
+    template<class Fixed>
+    std::vector<Fixed> arithmetic_operands(bool transpose)
+    {
+        using rep = typename std::decay<decltype(sg14::_impl::to_rep(std::declval<typename Fixed::rep>()))>::type;
+        auto const lowest = static_cast<std::int64_t>(std::numeric_limits<rep>::lowest());
+        auto const max = static_cast<std::int64_t>(std::numeric_limits<rep>::max());
+        auto const stride = std::max<std::int64_t>((max-lowest)/96, 1);
+
+        auto values = std::vector<std::int64_t>{};
+        for (auto value = lowest; value<max; value += stride) {
+            values.push_back(value);
+        }
+        values.push_back(max);
+
+        auto operands = std::vector<Fixed>{};
+        for (auto i : values) {
+            for (auto j : values) {
+                operands.push_back(Fixed::from_data(static_cast<rep>(transpose ? j : i)));
+            }
+        }
+        return operands;
+    }
+
+    template<class Operator, class Fixed>
+    void test_arithmetic()
+    {
+        using sg14::_impl::fp::batch::transform;
+        auto const lhs = arithmetic_operands<Fixed>(false);
+        auto const rhs = arithmetic_operands<Fixed>(true);
+        auto expected = std::vector<Fixed>(lhs.size(), Fixed{0});
+        transform<Operator>(instruction_set::scalar, lhs.data(), lhs.data()+lhs.size(), rhs.data(), expected.data());
+
+        for (auto set : {instruction_set::sse4_1, instruction_set::avx2, instruction_set::avx512}) {
+            if (set>sg14::supported_instruction_set()) {
+                continue;
+            }
+
+            auto actual = std::vector<Fixed>(lhs.size(), Fixed{0});
+            auto end = transform<Operator>(set, lhs.data(), lhs.data()+lhs.size(), rhs.data(), actual.data());
+            ASSERT_EQ(actual.data()+actual.size(), end);
+            for (auto i = std::size_t{0}; i!=lhs.size(); ++i) {
+                ASSERT_EQ(expected[i].data(), actual[i].data())
+                                            << "instruction set " << static_cast<int>(set)
+                                            << ", operands " << +sg14::_impl::to_rep(lhs[i].data())
+                                            << ", " << +sg14::_impl::to_rep(rhs[i].data());
+            }
+        }
+    }
+
+    template<class Fixed>
+    void test_arithmetic()
+    {
+        test_arithmetic<sg14::_impl::add_op, Fixed>();
+        test_arithmetic<sg14::_impl::subtract_op, Fixed>();
+        test_arithmetic<sg14::_impl::multiply_op, Fixed>();
+    }
+
+    TEST(fixed_point_batch, arithmetic)
+    {
+        static_assert(sg14::_impl::fp::batch::saturating_vectorizable<
+                sg14::_impl::multiply_op, sg14::safe_integer<std::int16_t, sg14::saturated_overflow_tag>, -15>::value,
+                "sg14::_impl::fp::batch::saturating_vectorizable test failed");
+        static_assert(!sg14::_impl::fp::batch::saturating_vectorizable<
+                sg14::_impl::add_op, std::int16_t, -15>::value,
+                "sg14::_impl::fp::batch::saturating_vectorizable test failed");
+        static_assert(!sg14::_impl::fp::batch::saturating_vectorizable<
+                sg14::_impl::multiply_op, sg14::safe_integer<std::uint16_t, sg14::saturated_overflow_tag>, -16>::value,
+                "sg14::_impl::fp::batch::saturating_vectorizable test failed");
+
+        test_arithmetic<saturated<std::int8_t, -7>>();
+        test_arithmetic<saturated<std::int8_t, -14>>();
+        test_arithmetic<saturated<std::uint8_t, -4>>();
+        test_arithmetic<saturated<std::int16_t, -15>>();
+        test_arithmetic<saturated<std::int16_t, -8>>();
+        test_arithmetic<saturated<std::int16_t, 0>>();
+        test_arithmetic<saturated<std::uint16_t, -16>>();
+
+        using sg14::_impl::fp::batch::q_mul_round_op;
+        test_arithmetic<q_mul_round_op, fixed_point<std::int16_t, -15>>();
+        test_arithmetic<q_mul_round_op, fixed_point<std::int32_t, -31>>();
+        test_arithmetic<q_mul_round_op, fixed_point<std::int16_t, -8>>();
+    }
+
+    TEST(fixed_point_batch, arithmetic_functions)
+    {
+        using fp = saturated<std::int16_t, -15>;
+        auto const lhs = std::vector<fp>{
+                fp::from_data(30000), fp::from_data(-30000), -1, -1, .5, fp::from_data(-3), .25, .25, .25};
+        auto const rhs = std::vector<fp>{
+                fp::from_data(20000), fp::from_data(20000), -1, .5, -.5, fp::from_data(16384), .5, .5, .5};
+        auto output = std::vector<fp>(lhs.size(), fp{0});
+        auto const first1 = lhs.data();
+        auto const last1 = first1+lhs.size();
+
+        EXPECT_EQ(output.data()+output.size(), sg14::add(first1, last1, rhs.data(), output.data()));
+        EXPECT_EQ(std::numeric_limits<fp>::max(), output[0]);
+        EXPECT_EQ(fp::from_data(-10000), output[1]);
+        EXPECT_EQ(std::numeric_limits<fp>::lowest(), output[2]);
+        EXPECT_EQ(.75, output[6]);
+
+        sg14::subtract(first1, last1, rhs.data(), output.data());
+        EXPECT_EQ(fp::from_data(10000), output[0]);
+        EXPECT_EQ(std::numeric_limits<fp>::lowest(), output[1]);
+        EXPECT_EQ(fp{0}, output[2]);
+        EXPECT_EQ(-.25, output[6]);
+
+        sg14::multiply(first1, last1, rhs.data(), output.data());
+        EXPECT_EQ(std::numeric_limits<fp>::max(), output[2]);
+        EXPECT_EQ(-.5, output[3]);
+        EXPECT_EQ(-.25, output[4]);
+        EXPECT_EQ(fp::from_data(-1), output[5]);
+        EXPECT_EQ(.125, output[8]);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // dot product
+
+    using q15 = fixed_point<std::int16_t, -15>;
+
+    static_assert(std::is_same<sg14::_impl::fp::batch::dot_result<q15, q15, 1>::type,
+            fixed_point<std::int32_t, -30>>::value, "sg14::_impl::fp::batch::dot_result test failed");
+    static_assert(std::is_same<sg14::_impl::fp::batch::dot_result<q15, q15, 2>::type,
+            fixed_point<std::int64_t, -30>>::value, "sg14::_impl::fp::batch::dot_result test failed");
+    static_assert(sg14::_impl::fp::batch::dot_result<
+            fixed_point<std::uint8_t, -8>, fixed_point<std::uint8_t, 0>, 256>::digits==24,
+            "sg14::_impl::fp::batch::dot_result test failed");
+
+    TEST(fixed_point_batch, dot)
+    {
+        using sg14::_impl::fp::batch::dot;
+        auto const lhs = sweep<q15>();
+        auto rhs = std::vector<q15>(lhs.rbegin(), lhs.rend());
+        std::fill(rhs.begin(), rhs.begin()+33, std::numeric_limits<q15>::lowest());
+
+        for (auto length : {std::size_t{0}, std::size_t{1}, std::size_t{31}, std::size_t{33}, lhs.size()}) {
+            auto const expected = dot<65536>(instruction_set::scalar, lhs.data(), lhs.data()+length, rhs.data());
+
+            for (auto set : {instruction_set::sse4_1, instruction_set::avx2, instruction_set::avx512}) {
+                if (set>sg14::supported_instruction_set()) {
+                    continue;
+                }
+
+                ASSERT_EQ(expected, dot<65536>(set, lhs.data(), lhs.data()+length, rhs.data()))
+                                            << "instruction set " << static_cast<int>(set) << ", length " << length;
+            }
+        }
+    }
+
+    TEST(fixed_point_batch, dot_functions)
+    {
+        auto const lowest = std::vector<q15>(1000, std::numeric_limits<q15>::lowest());
+        EXPECT_EQ(1000, sg14::dot<1000>(lowest.data(), lowest.data()+lowest.size(), lowest.data()));
+
+        q15 const lhs[] = {.5, -.25, .125, 0.};
+        q15 const rhs[] = {.5, .5, -1., .75};
+        EXPECT_EQ(0, sg14::dot(lhs, rhs));
+
+        fixed_point<std::int8_t, -7> const unit[] = {-1., -1.};
+        EXPECT_EQ(2, sg14::dot(unit, unit));
+    }
+}
@@ -786,6 +786,24 @@ static_assert(identical(divide(fixed_point<uint64, 0>{0xFFFFFFFE00000001LL}, fix
 static_assert(identical(divide(fixed_point<uint32, 0>{0xFFFE0001LL}, fixed_point<uint32, 0>{0xffff}),
         fixed_point<uint32, 0>{0xffff}), "sg14::fixed_point test failed");
 
+namespace test_divide_const_integer {
+    using namespace sg14::literals;
+
+    // the rep is divided, rounding toward zero
+    static_assert(identical(fixed_point<test_int, -8>{7}/3_c, fixed_point<test_int, -8>::from_data(597)),
+            "sg14::fixed_point division test failed");
+    static_assert(identical(fixed_point<test_int, -8>{-7}/3_c, fixed_point<test_int, -8>::from_data(-597)),
+            "sg14::fixed_point division test failed");
+    static_assert(identical(fixed_point<test_int, -8>{-7}/-10_c, fixed_point<test_int, -8>::from_data(179)),
+            "sg14::fixed_point division test failed");
+    static_assert(identical(fixed_point<test_unsigned, -16>{1000}/641_c, fixed_point<test_unsigned, -16>::from_data(102240)),
+            "sg14::fixed_point division test failed");
+    static_assert(identical(fixed_point<int64, -32>{-1000}/4_c, fixed_point<int64, -32>{-250}),
+            "sg14::fixed_point division test failed");
+    static_assert(identical(fixed_point<uint64, 0>{UINT64_MAX}/7_c, fixed_point<uint64, 0>{UINT64_MAX/7}),
+            "sg14::fixed_point division test failed");
+}
+
 namespace test_bitshift {
     // dynamic
     static_assert(identical(fixed_point<int, -4>{2}, fixed_point<uint8_t, -4>{1} << 1), "bitshift test failed");
@@ -901,6 +919,12 @@ static_assert(numeric_limits<fixed_point<test_unsigned, 256>>::max() > 1.e86, "s
 
 static_assert(sqrt(make_ufixed<8, 0>(225))==15, "sg14::sqrt test failed");
 static_assert(sqrt(make_fixed<7, 0>(81))==9, "sg14::sqrt test failed");
+static_assert(sqrt(make_ufixed<16, 0>(65535))==255, "sg14::sqrt test failed");
+static_assert(sqrt(make_ufixed<16, 0>(65025))==255, "sg14::sqrt test failed");
+static_assert(sqrt(make_ufixed<16, 0>(65024))==254, "sg14::sqrt test failed");
+static_assert(sqrt(make_fixed<31, 0>(2147395600))==46340, "sg14::sqrt test failed");
+static_assert(sqrt(make_fixed<31, 0>(2147395599))==46339, "sg14::sqrt test failed");
+static_assert(sqrt(make_fixed<15, 16>(2))==make_fixed<15, 16>::from_data(92681), "sg14::sqrt test failed");
 
 #if defined(TEST_SATURATED_OVERFLOW) && !defined(TEST_IGNORE_MSVC_INTERNAL_ERRORS)
 static_assert(sqrt(make_ufixed<7, 1>(4))==2, "sg14::sqrt test failed");
@@ -15,3 +15,162 @@
 #include "fixed_point_math_Q15.cpp"
 #include "fixed_point_math_Q31.cpp"
 
+
+#include <cmath>
+
+//The degree of the exp2 polynomial grows with the width of the fraction
+static_assert(sg14::_impl::fp::exp2_select<8>::degree == 3, "");
+static_assert(sg14::_impl::fp::exp2_select<16>::degree == 4, "");
+static_assert(sg14::_impl::fp::exp2_select<32>::degree == 7, "");
+static_assert(sg14::_impl::fp::exp2_select<56>::degree == 11, "");
+static_assert(sg14::_impl::fp::exp2_select<57>::degree == 12, "");
+static_assert(sg14::_impl::fp::exp2_select<61>::degree == 12, "");
+static_assert(sg14::_impl::fp::exp2_select<62>::degree == 13, "");
+static_assert(sg14::_impl::fp::exp2_select<63>::degree == 13, "");
+static_assert(sg14::_impl::fp::exp2_select<64>::degree == 13, "");
+
+//Results are truncated to the LSB, on top of the error of the polynomial
+//which is evaluated in an unsigned fraction of the same width
+template<class Fixed>
+void test_exp2_sweep() {
+    using rep = typename Fixed::rep;
+    auto const tolerance = std::ldexp(1., Fixed::exponent)
+            + std::ldexp(1., -std::numeric_limits<typename std::make_unsigned<rep>::type>::digits);
+    //Sweep the values whose result is representable
+    auto const lo = static_cast<double>(std::numeric_limits<Fixed>::lowest());
+    auto const hi = std::min(static_cast<double>(Fixed::integer_digits)-.5, static_cast<double>(std::numeric_limits<Fixed>::max()));
+    auto const steps = 4096;
+    for (auto step = 0; step <= steps; ++step) {
+        auto const x = Fixed{lo + (hi - lo) * step / steps};
+        auto const expected = std::exp2(static_cast<double>(x));
+        EXPECT_NEAR(static_cast<double>(exp2(x)), expected, tolerance + std::ldexp(expected, -52))
+            << "x raw: " << static_cast<long long>(rep{x.data()});
+    }
+}
+
+TEST(math, exp2_precision) {
+    test_exp2_sweep<sg14::fixed_point<int8_t, -4>>();
+    test_exp2_sweep<sg14::fixed_point<uint8_t, -6>>();
+    test_exp2_sweep<sg14::fixed_point<int16_t, -8>>();
+    test_exp2_sweep<sg14::fixed_point<int16_t, -12>>();
+    test_exp2_sweep<sg14::fixed_point<uint16_t, -14>>();
+    test_exp2_sweep<sg14::fixed_point<int32_t, -24>>();
+#if defined(SG14_INT128_ENABLED)
+    test_exp2_sweep<sg14::fixed_point<int64_t, -48>>();
+#endif
+}
+
+#if defined(SG14_INT128_ENABLED)
+//Beyond 62 fractional digits, no polynomial is within half the LSB; that of the highest degree is within 2^-63
+//and its evaluation in 64 fractional digits adds a few LSBs. The expected values are calculated in long double.
+TEST(math, exp2_precision_64) {
+    if (std::numeric_limits<long double>::digits < 64) {
+        return;
+    }
+
+    using fraction = sg14::fixed_point<uint64_t, -64>;
+    for (auto step = 0; step != 4096; ++step) {
+        auto const x = fraction::from_data(
+                static_cast<uint64_t>(step) * UINT64_C(0x10000000000000) + UINT64_C(0x123456789));
+        auto const expected = std::exp2(std::ldexp(static_cast<long double>(x.data()), -64)) - 1;
+        auto const actual = sg14::_impl::fp::exp2m1_0to1(x);
+        EXPECT_LE(std::fabs(std::ldexp(static_cast<long double>(actual.data()), -64) - expected), std::ldexp(1.L, -61))
+            << "x raw: " << x.data();
+    }
+
+    using q62 = sg14::fixed_point<int64_t, -62>;
+    for (auto step = 0; step != 4096; ++step) {
+        auto const x = q62::from_data(
+                INT64_C(-0x5000000000000000) + static_cast<int64_t>(step) * INT64_C(0x7000000000000) + step);
+        auto const expected = std::exp2(std::ldexp(static_cast<long double>(x.data()), -62));
+        EXPECT_LE(std::fabs(std::ldexp(static_cast<long double>(exp2(x).data()), -62) - expected),
+                std::ldexp(1.L, -62) + std::ldexp(1.L, -61))
+            << "x raw: " << x.data();
+    }
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// activation functions
+
+static_assert(sg14::sigmoid(sg14::fixed_point<int16_t, -12>{0}) == .5, "sg14::sigmoid test failed");
+static_assert(sg14::tanh(sg14::fixed_point<int16_t, -12>{0}) == 0, "sg14::tanh test failed");
+static_assert(sg14::gelu(sg14::fixed_point<int16_t, -12>{0}) == 0, "sg14::gelu test failed");
+static_assert(sg14::softplus(sg14::fixed_point<int16_t, -12>{0}).data() == 2839, "sg14::softplus test failed");
+
+namespace {
+    double reference_gelu(double x) {
+        return .5*x*(1.+std::tanh(std::sqrt(2./3.14159265358979323846)*(x+.044715*x*x*x)));
+    }
+
+    double reference_sigmoid(double x) {
+        return 1./(1.+std::exp(-x));
+    }
+
+    double reference_softplus(double x) {
+        return std::max(x, 0.)+std::log1p(std::exp(-std::abs(x)));
+    }
+
+    //Compares f with reference, clamped to the range of Fixed, within 1 LSB
+    template<class Fixed, class Function, class Reference>
+    void test_activation_sweep(Function f, Reference reference) {
+        using rep = typename Fixed::rep;
+        auto const lsb = std::ldexp(1., Fixed::exponent);
+        auto const lo = static_cast<double>(std::numeric_limits<Fixed>::lowest());
+        auto const hi = static_cast<double>(std::numeric_limits<Fixed>::max());
+        auto const steps = 8192;
+        for (auto step = 0; step <= steps; ++step) {
+            auto const x = Fixed{lo + (hi - lo) * step / steps};
+            auto const expected = std::min(std::max(reference(static_cast<double>(x)), lo), hi);
+            EXPECT_NEAR(static_cast<double>(f(x)), expected, lsb)
+                << "x raw: " << static_cast<long long>(rep{x.data()});
+        }
+    }
+
+    template<class Fixed>
+    void test_activations() {
+        test_activation_sweep<Fixed>([](Fixed x) { return tanh(x); }, [](double x) { return std::tanh(x); });
+        test_activation_sweep<Fixed>([](Fixed x) { return sigmoid(x); }, reference_sigmoid);
+        test_activation_sweep<Fixed>([](Fixed x) { return softplus(x); }, reference_softplus);
+        test_activation_sweep<Fixed>([](Fixed x) { return gelu(x); }, reference_gelu);
+    }
+}
+
+TEST(math, activation_precision) {
+    test_activations<sg14::fixed_point<int8_t, -4>>();
+    test_activations<sg14::fixed_point<int8_t, -7>>();
+    test_activations<sg14::fixed_point<uint8_t, -6>>();
+    test_activations<sg14::fixed_point<int16_t, -12>>();
+    test_activations<sg14::fixed_point<int16_t, -15>>();
+    test_activations<sg14::fixed_point<uint16_t, -16>>();
+    test_activations<sg14::fixed_point<int32_t, -16>>();
+    test_activations<sg14::fixed_point<int32_t, -24>>();
+    test_activations<sg14::fixed_point<int32_t, -31>>();
+    test_activations<sg14::fixed_point<int32_t, 2>>();
+}
+
+TEST(math, activation_batch) {
+    using fp = sg14::fixed_point<int16_t, -12>;
+    fp input[257];
+    for (auto i = 0; i != 257; ++i) {
+        input[i] = fp::from_data(static_cast<int16_t>(i*255-32768));
+    }
+    fp output[257];
+    EXPECT_EQ(sg14::tanh(input, input+257, output), output+257);
+    for (auto i = 0; i != 257; ++i) {
+        EXPECT_EQ(output[i], tanh(input[i]));
+    }
+    sg14::sigmoid(input, input+257, output);
+    for (auto i = 0; i != 257; ++i) {
+        EXPECT_EQ(output[i], sigmoid(input[i]));
+    }
+    sg14::softplus(input, input+257, output);
+    for (auto i = 0; i != 257; ++i) {
+        EXPECT_EQ(output[i], softplus(input[i]));
+    }
+    //in place
+    sg14::gelu(input, input+257, input);
+    for (auto i = 0; i != 257; ++i) {
+        EXPECT_EQ(input[i], gelu(fp::from_data(static_cast<int16_t>(i*255-32768))));
+    }
+}
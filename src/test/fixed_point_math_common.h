@@ -85,3 +85,118 @@ TEST(math, FPTESTFORMAT) {
     }
 }
 
+
+TEST(math_log, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+
+    //Expected raw value of the result, rounded to nearest and saturated
+    auto expected_rep = [](double value) -> int64_t {
+        return static_cast<int64_t>(std::min(std::max(
+                std::round(std::ldexp(value, -fp::exponent)),
+                static_cast<double>(std::numeric_limits<int32_t>::lowest())),
+                static_cast<double>(std::numeric_limits<int32_t>::max())));
+    };
+
+    //Sweep the positive range geometrically so that every binade is covered
+    for (int64_t raw = 1; raw <= std::numeric_limits<int32_t>::max(); raw += 1 + raw / 97) {
+        auto x = fp::from_data(static_cast<int32_t>(raw));
+        auto d = static_cast<double>(x);
+
+        EXPECT_LE(std::abs(log2(x).data() - expected_rep(std::log2(d))), 1)
+            << "log2 fail at " << d;
+        EXPECT_LE(std::abs(log(x).data() - expected_rep(std::log(d))), 1)
+            << "log fail at " << d;
+        EXPECT_LE(std::abs(log10(x).data() - expected_rep(std::log10(d))), 1)
+            << "log10 fail at " << d;
+    }
+
+    //Powers of two are exact
+    for (int i = -fp::fractional_digits; i < fp::integer_digits; i++) {
+        EXPECT_EQ(log2(fp::from_data(int32_t{ 1 } << (i - fp::exponent))).data(), expected_rep(i));
+    }
+}
+
+TEST(math_exp, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+
+    //Expected raw value of the result, rounded to nearest and saturated
+    auto expected_rep = [](double value) -> int64_t {
+        return static_cast<int64_t>(std::min(std::max(
+                std::round(std::ldexp(value, -fp::exponent)),
+                static_cast<double>(std::numeric_limits<int32_t>::lowest())),
+                static_cast<double>(std::numeric_limits<int32_t>::max())));
+    };
+
+    auto tolerance = 1;
+
+    for (int64_t raw = std::numeric_limits<int32_t>::lowest(); raw <= std::numeric_limits<int32_t>::max(); raw += 65537) {
+        auto x = fp::from_data(static_cast<int32_t>(raw));
+        auto d = static_cast<double>(x);
+
+        EXPECT_LE(std::abs(exp(x).data() - expected_rep(std::exp(d))), tolerance)
+            << "exp fail at " << d;
+    }
+}
+
+TEST(math_pow, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+
+    //Expected raw value of the result, rounded to nearest and saturated
+    auto expected_rep = [](double value) -> int64_t {
+        return static_cast<int64_t>(std::min(std::max(
+                std::round(std::ldexp(value, -fp::exponent)),
+                static_cast<double>(std::numeric_limits<int32_t>::lowest())),
+                static_cast<double>(std::numeric_limits<int32_t>::max())));
+    };
+
+    for (double raw_x = 1; raw_x <= std::numeric_limits<int32_t>::max(); raw_x = raw_x * 1.37 + 1) {
+        auto x = fp::from_data(static_cast<int32_t>(raw_x));
+        for (int64_t raw_y = std::numeric_limits<int32_t>::lowest(); raw_y <= std::numeric_limits<int32_t>::max(); raw_y += 33554467) {
+            auto y = fp::from_data(static_cast<int32_t>(raw_y));
+            auto expected = expected_rep(std::pow(static_cast<double>(x), static_cast<double>(y)));
+
+            //The 32-bit exp2 polynomial limits the relative precision of large results
+            auto tolerance = 2 + std::ldexp(static_cast<double>(std::abs(expected)), -29);
+            EXPECT_LE(std::abs(pow(x, y).data() - expected), tolerance)
+                << "pow fail at " << static_cast<double>(x) << "^" << static_cast<double>(y);
+        }
+    }
+
+#if (FPTESTEXP > -31)
+    //Powers of two with integer exponents are exact
+    for (int i = -fp::fractional_digits; i < fp::integer_digits; ++i) {
+        auto x = fp::from_data(int32_t{1} << (i - fp::exponent));
+        EXPECT_EQ(pow(x, fp{1}), x);
+        EXPECT_EQ(pow(x, 1), x);
+    }
+#endif
+}
+
+TEST(math_pow_integer, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+    using namespace sg14::literals;
+
+    for (double raw_x = 1; raw_x <= std::numeric_limits<int32_t>::max(); raw_x = raw_x * 1.37 + 1) {
+        for (auto sign = -1; sign <= 1; sign += 2) {
+            auto x = fp::from_data(static_cast<int32_t>(sign * raw_x));
+            auto d = static_cast<double>(x);
+
+            auto lsb = std::ldexp(1., fp::exponent);
+#if (FPTESTEXP > -31)
+            EXPECT_EQ(pow(x, 0), 1);
+#endif
+            EXPECT_EQ(pow(x, 1), x);
+            EXPECT_EQ(pow(x, 1_c), x);
+            if (std::abs(d * d) < static_cast<double>(std::numeric_limits<fp>::max())) {
+                EXPECT_NEAR(static_cast<double>(pow(x, 2)), d * d, lsb / 2);
+                EXPECT_EQ(pow(x, 2_c), pow(x, 2));
+            }
+            if (std::abs(d * d * d) < static_cast<double>(std::numeric_limits<fp>::max())) {
+                EXPECT_NEAR(static_cast<double>(pow(x, 3)), d * d * d, lsb / 2);
+                EXPECT_EQ(pow(x, 3_c), pow(x, 3));
+                EXPECT_EQ(pow(x, 5_c), pow(x, 5));
+                EXPECT_EQ(pow(x, -3_c), pow(x, -3));
+            }
+        }
+    }
+}
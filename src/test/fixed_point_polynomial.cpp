@@ -0,0 +1,81 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/fixed_point>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace {
+    using sg14::fixed_point;
+    using sg14::polynomial;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // compile-time evaluation
+
+    // 1 + 2x + 3x^2 + 4x^3 in Q16
+    using cubic = polynomial<fixed_point<std::int32_t, -16>, 65536, 131072, 196608, 262144>;
+
+    static_assert(cubic::degree==3, "sg14::polynomial test failed");
+    static_assert(cubic::evaluate(fixed_point<std::int32_t, -16>(0))==1, "sg14::polynomial test failed");
+    static_assert(cubic::evaluate(fixed_point<std::int32_t, -16>(.5))==3.25, "sg14::polynomial test failed");
+    static_assert(cubic::evaluate(fixed_point<std::int32_t, -16>(.5), sg14::estrin)==3.25,
+            "sg14::polynomial test failed");
+    static_assert(cubic::evaluate(fixed_point<std::int16_t, -8>(-1))==-2, "sg14::polynomial test failed");
+    static_assert(cubic::evaluate(fixed_point<std::int16_t, -8>(-1), sg14::estrin)==-2,
+            "sg14::polynomial test failed");
+
+    static_assert(polynomial<fixed_point<std::uint8_t, -4>, 40>::evaluate(fixed_point<std::uint8_t, -4>(3))==2.5,
+            "sg14::polynomial test failed");
+
+    // products are rounded to nearest: 1/3 * 1/2 in Q4 is 5/16 * 8/16 = 2.5/16
+    static_assert(polynomial<fixed_point<std::uint8_t, -4>, 0, 5>::evaluate(fixed_point<std::uint8_t, -4>(.5))
+                  ==fixed_point<std::uint8_t, -4>::from_data(3), "sg14::polynomial test failed");
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // accuracy
+
+    // Taylor series of sin(x) to x^9 in Q28
+    using sin_taylor = polynomial<fixed_point<std::int32_t, -28>,
+            0, 268435456, 0, -44739243, 0, 2236962, 0, -53261, 0, 740>;
+
+    // powers of x are held in the type of x, so the range of x is limited to [-1, 1]
+    template<class Tag>
+    void test_sin_taylor(Tag tag)
+    {
+        auto const steps = 10000;
+        for (auto step = -steps; step<=steps; ++step) {
+            auto const x = fixed_point<std::int32_t, -28>{1.*step/steps};
+            auto const d = static_cast<double>(x);
+            auto const expected = std::ldexp(
+                    268435456*d-44739243*std::pow(d, 3)+2236962*std::pow(d, 5)-53261*std::pow(d, 7)
+                    +740*std::pow(d, 9), -28);
+
+            // each rounded product may contribute half an LSB
+            ASSERT_NEAR(static_cast<double>(sin_taylor::evaluate(x, tag)), expected, std::ldexp(1., -28)*5) << d;
+        }
+    }
+}
+
+TEST(fixed_point_polynomial, horner)
+{
+    test_sin_taylor(sg14::horner);
+}
+
+TEST(fixed_point_polynomial, estrin)
+{
+    test_sin_taylor(sg14::estrin);
+}
+
+TEST(fixed_point_polynomial, mixed_types)
+{
+    // x in Q15 and coefficients in Q28
+    for (auto raw = -32768; raw<32768; raw += 7) {
+        auto const x = fixed_point<std::int16_t, -15>::from_data(static_cast<std::int16_t>(raw));
+        EXPECT_EQ(sin_taylor::evaluate(x), sin_taylor::evaluate(fixed_point<std::int32_t, -28>{x}));
+    }
+}
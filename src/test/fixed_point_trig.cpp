@@ -0,0 +1,171 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/fixed_point>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    using sg14::fixed_point;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // compile-time evaluation
+
+    static_assert(sin(fixed_point<std::int16_t, -12>(0))==0, "sg14::sin test failed");
+    static_assert(cos(fixed_point<std::int16_t, -12>(0))==1, "sg14::cos test failed");
+    static_assert(sin(fixed_point<std::uint16_t, -14>(3.1415926/2))==1, "sg14::sin test failed");
+    static_assert(sin(fixed_point<std::int8_t, -7>(.5))==fixed_point<std::int8_t, -7>::from_data(61),
+            "sg14::sin test failed");
+    static_assert(cos(fixed_point<std::int32_t, -16>(-3.1415926))==-1, "sg14::cos test failed");
+    static_assert(sin(fixed_point<std::int32_t, -20>(-3.1415926/6))==-.5, "sg14::sin test failed");
+
+    static_assert(sin(fixed_point<std::int32_t, -16>(0), sg14::lookup_trig_tag<>{})==0, "sg14::sin test failed");
+    static_assert(cos(fixed_point<std::int32_t, -16>(0), sg14::lookup_trig_tag<>{})==1, "sg14::cos test failed");
+    static_assert(sin(fixed_point<std::int16_t, -8>(-3.1415926/6), sg14::lookup_trig_tag<64>{})==-.5,
+            "sg14::sin test failed");
+    static_assert(cos(fixed_point<std::int32_t, -16>(-3.1415926),
+            sg14::lookup_trig_tag<256, sg14::quadratic_interpolation_tag>{})==-1, "sg14::cos test failed");
+
+    static_assert(atan2(fixed_point<std::int16_t, -12>(0), fixed_point<std::int16_t, -12>(0))==0,
+            "sg14::atan2 test failed");
+    static_assert(atan2(fixed_point<std::int16_t, -12>(1), fixed_point<std::int16_t, -12>(1))
+                  ==fixed_point<std::int16_t, -12>::from_data(3217), "sg14::atan2 test failed");
+    static_assert(atan2(fixed_point<std::int16_t, -12>(-1), fixed_point<std::int16_t, -12>(-1))
+                  ==fixed_point<std::int16_t, -12>::from_data(-9651), "sg14::atan2 test failed");
+
+    static_assert(hypot(fixed_point<std::int32_t, -16>(3), fixed_point<std::int32_t, -16>(4))==5,
+            "sg14::hypot test failed");
+    static_assert(hypot(fixed_point<std::uint8_t, 0>(200), fixed_point<std::uint8_t, 0>(200))==255,
+            "sg14::hypot test failed");
+    static_assert(hypot(fixed_point<std::int64_t, 0>(-30000000000), fixed_point<std::int64_t, 0>(40000000000))
+                  ==50000000000, "sg14::hypot test failed");
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // accuracy
+
+    template<class Fixed>
+    double lsb()
+    {
+        return std::ldexp(1., Fixed::exponent);
+    }
+
+    // results are saturated to the range of the result type
+    template<class Fixed>
+    double clamp(double value)
+    {
+        return std::min(std::max(value, static_cast<double>(std::numeric_limits<Fixed>::lowest())),
+                static_cast<double>(std::numeric_limits<Fixed>::max()));
+    }
+
+    template<class Fixed, class Tag = sg14::cordic_trig_tag>
+    void test_sin_cos(int steps, double tolerance = lsb<Fixed>(), Tag tag = Tag{})
+    {
+        auto const lo = static_cast<double>(std::numeric_limits<Fixed>::lowest());
+        auto const hi = static_cast<double>(std::numeric_limits<Fixed>::max());
+        for (auto step = 0; step<=steps; ++step) {
+            auto const x = Fixed{lo+(hi-lo)*step/steps};
+            auto const expected_sin = clamp<Fixed>(std::sin(static_cast<double>(x)));
+            auto const expected_cos = clamp<Fixed>(std::cos(static_cast<double>(x)));
+            ASSERT_NEAR(static_cast<double>(sin(x, tag)), expected_sin, tolerance) << static_cast<double>(x);
+            ASSERT_NEAR(static_cast<double>(cos(x, tag)), expected_cos, tolerance) << static_cast<double>(x);
+        }
+    }
+
+    template<class Fixed>
+    void test_atan2_hypot(int steps)
+    {
+        auto const lo = static_cast<double>(std::numeric_limits<Fixed>::lowest())/2;
+        auto const hi = static_cast<double>(std::numeric_limits<Fixed>::max())/2;
+        for (auto step_y = 0; step_y<=steps; ++step_y) {
+            auto const y = Fixed{lo+(hi-lo)*step_y/steps};
+            for (auto step_x = 0; step_x<=steps; ++step_x) {
+                auto const x = Fixed{lo+(hi-lo)*step_x/steps};
+                if (x==0 && y==0) {
+                    continue;
+                }
+
+                auto const expected_atan2 = std::atan2(static_cast<double>(y), static_cast<double>(x));
+                if (expected_atan2<static_cast<double>(std::numeric_limits<Fixed>::max())) {
+                    ASSERT_NEAR(static_cast<double>(atan2(y, x)), expected_atan2, lsb<Fixed>());
+                }
+
+                auto const expected_hypot = std::hypot(static_cast<double>(x), static_cast<double>(y));
+                ASSERT_NEAR(static_cast<double>(hypot(x, y)), expected_hypot, lsb<Fixed>());
+            }
+        }
+    }
+}
+
+TEST(fixed_point_trig, sin_cos)
+{
+    test_sin_cos<fixed_point<std::int8_t, -5>>(255);
+    test_sin_cos<fixed_point<std::uint8_t, -5>>(255);
+    test_sin_cos<fixed_point<std::int16_t, -12>>(65535);
+    test_sin_cos<fixed_point<std::int16_t, -8>>(65535);
+    test_sin_cos<fixed_point<std::int32_t, -16>>(100000);
+    test_sin_cos<fixed_point<std::int32_t, -28>>(100000);
+    test_sin_cos<fixed_point<std::uint32_t, -30>>(100000);
+    test_sin_cos<fixed_point<std::int32_t, 0>>(100000);
+}
+
+TEST(fixed_point_trig, lookup_sin_cos)
+{
+    using sg14::lookup_trig_tag;
+    using sg14::quadratic_interpolation_tag;
+
+    // h*h/8 with h = pi/(2*64) is below half the LSB of s7:8
+    test_sin_cos<fixed_point<std::int16_t, -8>>(65535, lsb<fixed_point<std::int16_t, -8>>(), lookup_trig_tag<64>{});
+
+    // h*h/8 with h = pi/(2*256) is below half the LSB of s15:16
+    test_sin_cos<fixed_point<std::int32_t, -16>>(100000, lsb<fixed_point<std::int32_t, -16>>(), lookup_trig_tag<256>{});
+
+    // h*h*h/15 with h = pi/(2*256) is below half the LSB of s7:24
+    test_sin_cos<fixed_point<std::int32_t, -24>>(
+            100000, lsb<fixed_point<std::int32_t, -24>>(),
+            lookup_trig_tag<256, quadratic_interpolation_tag>{});
+    test_sin_cos<fixed_point<std::int32_t, -28>>(
+            100000, lsb<fixed_point<std::int32_t, -28>>(),
+            lookup_trig_tag<1024, quadratic_interpolation_tag>{});
+    test_sin_cos<fixed_point<std::uint16_t, -12>>(
+            65535, lsb<fixed_point<std::uint16_t, -12>>()+std::pow(3.1415926/2/16, 3)/15,
+            lookup_trig_tag<16, quadratic_interpolation_tag>{});
+}
+
+TEST(fixed_point_trig, atan2_hypot)
+{
+    test_atan2_hypot<fixed_point<std::int8_t, -4>>(255);
+    test_atan2_hypot<fixed_point<std::int16_t, -12>>(300);
+    test_atan2_hypot<fixed_point<std::int16_t, -4>>(300);
+    test_atan2_hypot<fixed_point<std::int32_t, -16>>(300);
+    test_atan2_hypot<fixed_point<std::int32_t, -28>>(300);
+}
+
+#if defined(SG14_INT128_ENABLED)
+// reps wider than the 64-bit working rep are not truncated to it
+TEST(fixed_point_trig, wide_rep)
+{
+    using fixed = fixed_point<SG14_INT128, -40>;
+    auto const lsb = std::ldexp(1., fixed::exponent);
+
+    auto const angle = fixed::from_data((SG14_INT128{1} << 80)+(SG14_INT128{1} << 40));
+    auto const reference = std::sin(std::ldexp(1.L, 40)+1);
+    EXPECT_NEAR(static_cast<double>(sin(angle)), static_cast<double>(reference), 1e-6);
+    EXPECT_NEAR(static_cast<double>(cos(angle)), static_cast<double>(std::cos(std::ldexp(1.L, 40)+1)), 1e-6);
+
+    auto const x = fixed::from_data(SG14_INT128{3} << 80);
+    auto const y = fixed::from_data(SG14_INT128{4} << 80);
+    EXPECT_EQ(hypot(x, y), fixed::from_data(SG14_INT128{5} << 80));
+    EXPECT_NEAR(static_cast<double>(atan2(y, x)), std::atan2(4., 3.), lsb);
+    EXPECT_NEAR(static_cast<double>(atan2(-y, -x)), std::atan2(-4., -3.), lsb);
+
+    // results are saturated to the range of the result type
+    auto const max = fixed::from_data(std::numeric_limits<SG14_INT128>::max());
+    EXPECT_EQ(hypot(max, max), max);
+}
+#endif
@@ -0,0 +1,123 @@
+
+//          Copyright John McFarlane 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/gemm.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    using sg14::fixed_point;
+    using sg14::instruction_set;
+
+    static_assert(std::is_same<sg14::gemm_result_t<fixed_point<std::int8_t, -7>, fixed_point<std::int8_t, -3>>,
+            fixed_point<std::int32_t, -10>>::value, "sg14::gemm test failed");
+    static_assert(std::is_same<sg14::gemm_result_t<fixed_point<std::int16_t, -15>, fixed_point<std::int8_t, 2>>,
+            fixed_point<std::int32_t, -13>>::value, "sg14::gemm test failed");
+
+    // a rows by columns matrix with rows beginning every stride elements, including runs of the lowest value
+    template<class T>
+    std::vector<T> matrix(std::size_t rows, std::size_t columns, std::size_t stride, unsigned seed)
+    {
+        using rep = typename T::rep;
+        auto elements = std::vector<T>(rows*stride, T{0});
+        for (auto row = std::size_t{0}; row!=rows; ++row) {
+            for (auto column = std::size_t{0}; column!=columns; ++column) {
+                seed = seed*1664525u+1013904223u;
+                elements[row*stride+column] = T::from_data((column%50<5)
+                                                           ? std::numeric_limits<rep>::min()
+                                                           : static_cast<rep>(seed >> 16));
+            }
+        }
+        return elements;
+    }
+
+    // the sums of the products modulo 2^32, one element at a time
+    template<class Lhs, class Rhs>
+    std::vector<std::int32_t> multiply(
+            std::size_t m, std::size_t n, std::size_t k, const std::vector<Lhs>& a, std::size_t lda,
+            const std::vector<Rhs>& b, std::size_t ldb)
+    {
+        auto c = std::vector<std::int32_t>(m*n);
+        for (auto i = std::size_t{0}; i!=m; ++i) {
+            for (auto j = std::size_t{0}; j!=n; ++j) {
+                auto sum = std::uint32_t{0};
+                for (auto p = std::size_t{0}; p!=k; ++p) {
+                    sum += static_cast<std::uint32_t>(std::int32_t{a[i*lda+p].data()}*b[p*ldb+j].data());
+                }
+                c[i*n+j] = static_cast<std::int32_t>(sum);
+            }
+        }
+        return c;
+    }
+
+    template<class Lhs, class Rhs>
+    void test_gemm(std::size_t m, std::size_t n, std::size_t k)
+    {
+        using result = sg14::gemm_result_t<Lhs, Rhs>;
+        using registry = sg14::_impl::dispatch::registry<sg14::_impl::fp::batch::gemm_key<Lhs, Rhs>>;
+
+        auto const lda = k+3;
+        auto const ldb = n+1;
+        auto const a = matrix<Lhs>(m, k, lda, 1);
+        auto const b = matrix<Rhs>(k, n, ldb, 2);
+        auto const expected = multiply(m, n, k, a, lda, b, ldb);
+
+        for (auto set : {instruction_set::scalar, instruction_set::sse4_1, instruction_set::avx2,
+                         instruction_set::avx512}) {
+            if (set>sg14::supported_instruction_set()) {
+                continue;
+            }
+
+            auto c = std::vector<result>(m*n, result::from_data(-1));
+            registry::select(set)(m, n, k, a.data(), lda, b.data(), ldb, c.data(), n);
+            for (auto i = std::size_t{0}; i!=m*n; ++i) {
+                ASSERT_EQ(expected[i], c[i].data())
+                                            << sg14::instruction_set_name(set) << ", m=" << m << ", n=" << n
+                                            << ", k=" << k << ", i=" << i;
+            }
+        }
+
+        auto c = std::vector<result>(m*n, result::from_data(-1));
+        sg14::gemm(m, n, k, a.data(), lda, b.data(), ldb, c.data(), n, 3);
+        for (auto i = std::size_t{0}; i!=m*n; ++i) {
+            ASSERT_EQ(expected[i], c[i].data()) << "threads=3, m=" << m << ", n=" << n << ", k=" << k << ", i=" << i;
+        }
+    }
+
+    using s0_7 = fixed_point<std::int8_t, -7>;
+    using s0_15 = fixed_point<std::int16_t, -15>;
+
+    TEST(gemm, int8)
+    {
+        test_gemm<s0_7, s0_7>(1, 1, 1);
+        test_gemm<s0_7, s0_7>(37, 45, 67);
+        test_gemm<s0_7, s0_7>(200, 70, 300);
+    }
+
+    TEST(gemm, int16)
+    {
+        test_gemm<s0_15, s0_15>(8, 32, 2);
+        test_gemm<s0_15, s0_15>(37, 45, 67);
+        test_gemm<s0_15, s0_7>(13, 2100, 259);
+        test_gemm<s0_15, s0_15>(5, 7, 0);
+    }
+
+    TEST(gemm, product)
+    {
+        using q7 = fixed_point<std::int8_t, -4>;
+        q7 const a[] = {1.5, -2., .25, 3.};
+        q7 const b[] = {.5, 1., -1., 2.};
+        sg14::gemm_result_t<q7, q7> c[4];
+        sg14::gemm(2, 2, 2, a, 2, b, 2, c, 2);
+        EXPECT_EQ(2.75, c[0]);
+        EXPECT_EQ(-2.5, c[1]);
+        EXPECT_EQ(-2.875, c[2]);
+        EXPECT_EQ(6.25, c[3]);
+    }
+}
@@ -4,6 +4,7 @@
 //  (See accompanying file ../../LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include <sg14/auxiliary/batch.h>
 #include <sg14/bits/type_traits.h>
 #include <sg14/fixed_point>
 
@@ -12,27 +13,298 @@
 using sg14::fixed_point;
 using sg14::make_fixed;
 using sg14::make_ufixed;
+using sg14::reciprocal;
+using sg14::rsqrt;
+using std::numeric_limits;
 
 TEST(utils_tests, sin)
 {
     ASSERT_EQ(sin(fixed_point<std::uint8_t, -6>(0)), 0);
-    ASSERT_EQ(sin(fixed_point<std::int16_t, -13>(3.1415926)), 0.f);
+    ASSERT_EQ(sin(fixed_point<std::int16_t, -13>(3.1415926)), .0001220703125);
     ASSERT_EQ(sin(fixed_point<std::uint16_t, -14>(3.1415926/2)), 1);
     ASSERT_EQ(sin(fixed_point<std::int32_t, -24>(3.1415926*7./2.)), -1);
     ASSERT_EQ(sin(fixed_point<std::int32_t, -28>(3.1415926/4)), .707106769f);
-    ASSERT_EQ(sin(fixed_point<std::int16_t, -10>(-3.1415926/3)), -.865234375);
+    ASSERT_EQ(sin(fixed_point<std::int16_t, -10>(-3.1415926/3)), -.8662109375);
 }
 
 TEST(utils_tests, cos)
 {
     ASSERT_EQ(cos(fixed_point<std::uint8_t, -6>(0)), 1.f);
     ASSERT_EQ(cos(fixed_point<std::int16_t, -13>(3.1415926)), -1);
-    ASSERT_EQ(cos(fixed_point<std::uint16_t, -14>(3.1415926/2)), 0.L);
+    ASSERT_EQ(cos(fixed_point<std::uint16_t, -14>(3.1415926/2)), .00006103515625);
     ASSERT_EQ(cos(fixed_point<std::int32_t, -20>(3.1415926*7./2.)), 0.f);
-    ASSERT_EQ(cos(fixed_point<std::int32_t, -28>(3.1415926/4)), .707106829f);
+    ASSERT_EQ(cos(fixed_point<std::int32_t, -28>(3.1415926/4)), (fixed_point<std::int32_t, -28>::from_data(189812534)));
     ASSERT_EQ(cos(fixed_point<std::int16_t, -10>(-3.1415926/3)), .5L);
 }
 
+namespace {
+    // compares sqrt against the bit-by-bit method over a geometric sweep of the input range
+    template<class Fixed>
+    void test_sqrt()
+    {
+        using rep = typename Fixed::rep;
+        using widened_rep = sg14::set_digits_t<rep, sg14::digits<rep>::value*2>;
+        auto const max = static_cast<double>(std::numeric_limits<rep>::max());
+        for (auto raw = 0.; raw<=max; raw = raw*1.001+1) {
+            auto const x = Fixed::from_data(static_cast<rep>(raw));
+            auto const widened = fixed_point<widened_rep, Fixed::exponent*2>{x}.data();
+            ASSERT_EQ(sqrt(x).data(), static_cast<rep>(sg14::_impl::fp::extras::sqrt_solve1(widened)))
+                                        << static_cast<double>(x);
+        }
+        auto const highest = std::numeric_limits<Fixed>::max();
+        auto const widened = fixed_point<widened_rep, Fixed::exponent*2>{highest}.data();
+        ASSERT_EQ(sqrt(highest).data(), static_cast<rep>(sg14::_impl::fp::extras::sqrt_solve1(widened)));
+    }
+}
+
+TEST(utils_tests, sqrt)
+{
+    test_sqrt<fixed_point<std::uint8_t, 0>>();
+    test_sqrt<fixed_point<std::int8_t, -4>>();
+    test_sqrt<fixed_point<std::uint16_t, -8>>();
+    test_sqrt<fixed_point<std::int16_t, 0>>();
+    test_sqrt<fixed_point<std::uint32_t, -16>>();
+    test_sqrt<fixed_point<std::int32_t, -30>>();
+#if defined(SG14_INT128_ENABLED)
+    test_sqrt<fixed_point<std::uint64_t, -32>>();
+    test_sqrt<fixed_point<std::int64_t, -2>>();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::rsqrt
+
+static_assert(rsqrt(make_ufixed<8, 8>(4))==.5, "sg14::rsqrt test failed");
+static_assert(rsqrt(make_fixed<15, 16>(.25))==2, "sg14::rsqrt test failed");
+static_assert(rsqrt<-30>(make_fixed<31, 0>(2147395600))==fixed_point<std::int32_t, -30>::from_data(23171),
+        "sg14::rsqrt test failed");
+static_assert(rsqrt(make_fixed<7, 8>(0))==numeric_limits<make_fixed<7, 8>>::max(), "sg14::rsqrt test failed");
+static_assert(rsqrt(make_ufixed<4, 4>(.00390625))==numeric_limits<make_ufixed<4, 4>>::max(),
+        "sg14::rsqrt test failed");
+
+namespace {
+    // compares rsqrt against floating-point over a geometric sweep of the positive input range
+    template<int ResultExponent, class Fixed>
+    void test_rsqrt()
+    {
+        using rep = typename Fixed::rep;
+        using result_type = fixed_point<rep, ResultExponent>;
+        auto const max = static_cast<double>(std::numeric_limits<rep>::max());
+        auto const result_max = static_cast<double>(std::numeric_limits<result_type>::max());
+        for (auto raw = 1.; raw<=max; raw = raw*1.001+1) {
+            auto const x = Fixed::from_data(static_cast<rep>(raw));
+            auto const expected = std::min(1./std::sqrt(static_cast<double>(x)), result_max);
+            // 64-bit results are only verified to the precision of double
+            auto const tolerance = std::max(std::ldexp(1., ResultExponent), std::ldexp(expected, -52));
+            ASSERT_NEAR(static_cast<double>(rsqrt<ResultExponent>(x)), expected, tolerance)
+                                        << static_cast<double>(x);
+        }
+    }
+}
+
+TEST(utils_tests, rsqrt)
+{
+    test_rsqrt<-4, fixed_point<std::uint8_t, 0>>();
+    test_rsqrt<-4, fixed_point<std::int8_t, -4>>();
+    test_rsqrt<-8, fixed_point<std::uint16_t, -8>>();
+    test_rsqrt<-15, fixed_point<std::int16_t, 0>>();
+    test_rsqrt<-16, fixed_point<std::uint32_t, -16>>();
+    test_rsqrt<-30, fixed_point<std::int32_t, -30>>();
+    test_rsqrt<-24, fixed_point<std::int32_t, 4>>();
+    test_rsqrt<-60, fixed_point<std::int64_t, -2>>();
+}
+
+TEST(utils_tests, rsqrt_batch)
+{
+    using input_type = fixed_point<std::int32_t, -16>;
+    using output_type = fixed_point<std::int32_t, -24>;
+    input_type const input[] = {1, 2, 4, 100, .01, 30000};
+    output_type output[6];
+    ASSERT_EQ(rsqrt(std::begin(input), std::end(input), std::begin(output)), std::end(output));
+    for (auto i = 0; i!=6; ++i) {
+        ASSERT_EQ(output[i], rsqrt<-24>(input[i]));
+    }
+    ASSERT_EQ(output[2], .5);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::reciprocal
+
+static_assert(reciprocal(make_ufixed<8, 8>(4))==.25, "sg14::reciprocal test failed");
+static_assert(reciprocal(make_fixed<15, 16>(-.125))==-8, "sg14::reciprocal test failed");
+static_assert(reciprocal<-30>(make_fixed<31, 0>(3))==fixed_point<std::int32_t, -30>::from_data(357913941),
+        "sg14::reciprocal test failed");
+static_assert(reciprocal(make_fixed<7, 8>(0))==numeric_limits<make_fixed<7, 8>>::max(),
+        "sg14::reciprocal test failed");
+static_assert(reciprocal(make_ufixed<4, 4>(.0625))==numeric_limits<make_ufixed<4, 4>>::max(),
+        "sg14::reciprocal test failed");
+
+static_assert(divide(make_fixed<15, 16>(3), make_fixed<15, 16>(-4), sg14::reciprocal_division)==-.75,
+        "sg14::divide test failed");
+static_assert(sg14::reciprocal_divisor<std::int32_t, -16>(make_fixed<15, 16>(3)).quotient(make_ufixed<8, 8>(1))
+              ==make_ufixed<8, 8>::from_data(85), "sg14::reciprocal_divisor test failed");
+static_assert(sg14::reciprocal_divisor<std::int16_t, -8>(make_fixed<7, 8>(0)).quotient(make_fixed<7, 8>(-1))
+              ==numeric_limits<make_fixed<7, 8>>::lowest(), "sg14::reciprocal_divisor test failed");
+
+namespace {
+    // compares reciprocal against floating-point over a geometric sweep of the non-zero input range
+    template<int ResultExponent, class Fixed>
+    void test_reciprocal()
+    {
+        using rep = typename Fixed::rep;
+        using result_type = fixed_point<rep, ResultExponent>;
+        auto const max = static_cast<double>(std::numeric_limits<rep>::max());
+        auto const result_max = static_cast<double>(std::numeric_limits<result_type>::max());
+        auto const result_lowest = static_cast<double>(std::numeric_limits<result_type>::lowest());
+        for (auto raw = 1.; raw<=max; raw = raw*1.001+1) {
+            for (auto sign : {1, -1}) {
+                if (sign<0 && !std::numeric_limits<rep>::is_signed) {
+                    continue;
+                }
+                auto const x = Fixed::from_data(static_cast<rep>(sign*raw));
+                auto const expected = std::max(std::min(1./static_cast<double>(x), result_max), result_lowest);
+                // 64-bit results are only verified to the precision of double
+                auto const tolerance = std::max(std::ldexp(1., ResultExponent), std::ldexp(std::abs(expected), -52));
+                ASSERT_NEAR(static_cast<double>(reciprocal<ResultExponent>(x)), expected, tolerance)
+                                            << static_cast<double>(x);
+            }
+        }
+    }
+
+    // compares division by reciprocal against floating-point over a geometric sweep of dividends and divisors
+    template<class Dividend, class Divisor>
+    void test_reciprocal_division()
+    {
+        using dividend_rep = typename Dividend::rep;
+        using divisor_rep = typename Divisor::rep;
+        auto const max = static_cast<double>(std::numeric_limits<Dividend>::max());
+        auto const lowest = static_cast<double>(std::numeric_limits<Dividend>::lowest());
+        for (auto d = 1.; d<=static_cast<double>(std::numeric_limits<divisor_rep>::max()); d = d*1.37+1) {
+            auto const divisor = sg14::reciprocal_divisor<divisor_rep, Divisor::exponent>{
+                    Divisor::from_data(static_cast<divisor_rep>(d))};
+            for (auto n = 0.; n<=static_cast<double>(std::numeric_limits<dividend_rep>::max()); n = n*1.37+1) {
+                auto const dividend = Dividend::from_data(static_cast<dividend_rep>(n));
+                auto const expected = std::max(std::min(
+                        static_cast<double>(dividend)/static_cast<double>(divisor.divisor()), max), lowest);
+                auto const tolerance = std::max(std::ldexp(1., Dividend::exponent), std::ldexp(expected, -52));
+                ASSERT_NEAR(static_cast<double>(divisor.quotient(dividend)), expected, tolerance)
+                                            << static_cast<double>(dividend) << '/' << static_cast<double>(divisor.divisor());
+                ASSERT_NEAR(static_cast<double>(divide(dividend, divisor.divisor(), sg14::reciprocal_division)),
+                        expected, tolerance);
+            }
+        }
+    }
+}
+
+TEST(utils_tests, reciprocal)
+{
+    test_reciprocal<-4, fixed_point<std::uint8_t, 0>>();
+    test_reciprocal<-4, fixed_point<std::int8_t, -4>>();
+    test_reciprocal<-8, fixed_point<std::uint16_t, -8>>();
+    test_reciprocal<-15, fixed_point<std::int16_t, 0>>();
+    test_reciprocal<-16, fixed_point<std::uint32_t, -16>>();
+    test_reciprocal<-30, fixed_point<std::int32_t, -30>>();
+    test_reciprocal<-24, fixed_point<std::int32_t, 4>>();
+    test_reciprocal<-60, fixed_point<std::int64_t, -2>>();
+}
+
+TEST(utils_tests, reciprocal_division)
+{
+    test_reciprocal_division<fixed_point<std::uint8_t, -4>, fixed_point<std::uint8_t, -4>>();
+    test_reciprocal_division<fixed_point<std::int16_t, -8>, fixed_point<std::uint16_t, -12>>();
+    test_reciprocal_division<fixed_point<std::int32_t, -16>, fixed_point<std::int32_t, -16>>();
+    test_reciprocal_division<fixed_point<std::uint32_t, -31>, fixed_point<std::int16_t, 0>>();
+    test_reciprocal_division<fixed_point<std::int64_t, -32>, fixed_point<std::int64_t, -32>>();
+}
+
+TEST(utils_tests, reciprocal_division_batch)
+{
+    using pixel = fixed_point<std::uint16_t, -8>;
+    pixel const input[] = {0, 1, 2.5, 100, 255};
+    pixel output[5];
+    auto const denominator = sg14::reciprocal_divisor<std::int32_t, -16>{fixed_point<std::int32_t, -16>{2.5}};
+    ASSERT_EQ(divide(std::begin(input), std::end(input), denominator, std::begin(output)), std::end(output));
+    for (auto i = 0; i!=5; ++i) {
+        ASSERT_EQ(output[i], denominator.quotient(input[i]));
+    }
+    ASSERT_EQ(output[2], 1);
+    ASSERT_EQ(output[3], 40);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::q_mul_round
+
+using q15 = fixed_point<std::int16_t, -15>;
+using q31 = fixed_point<std::int32_t, -31>;
+
+static_assert(q_mul_round(q15{.5}, q15{-.5})==-.25, "sg14::q_mul_round test failed");
+static_assert(q_mul_round(q15{-1}, q15{-1})==numeric_limits<q15>::max(), "sg14::q_mul_round test failed");
+static_assert(q_mul_round(q15::from_data(3), q15{.5})==q15::from_data(2), "sg14::q_mul_round test failed");
+static_assert(q_mul_round(q15::from_data(-3), q15{.5})==q15::from_data(-1), "sg14::q_mul_round test failed");
+static_assert(q_mul_round(numeric_limits<q31>::lowest(), numeric_limits<q31>::lowest())==numeric_limits<q31>::max(), "sg14::q_mul_round test failed");
+static_assert(q_mul_round(q31::from_data(-5), q31{.5})==q31::from_data(-2), "sg14::q_mul_round test failed");
+static_assert(q_mul_round(make_fixed<7, 8>(100), make_fixed<7, 8>(2))==numeric_limits<make_fixed<7, 8>>::max(),
+        "sg14::q_mul_round test failed");
+
+namespace {
+    // the ETSI/ITU-T basic operators from which mult_r can be composed, as round(L_mult(var1, var2))
+    std::int32_t l_mult(std::int16_t var1, std::int16_t var2)
+    {
+        auto const product = std::int32_t{var1}*var2;
+        return (product!=0x40000000) ? product*2 : std::numeric_limits<std::int32_t>::max();
+    }
+
+    std::int16_t round(std::int32_t l_var1)
+    {
+        auto const sum = std::int64_t{l_var1}+0x8000;
+        return static_cast<std::int16_t>(std::min<std::int64_t>(sum, std::numeric_limits<std::int32_t>::max()) >> 16);
+    }
+}
+
+TEST(utils_tests, q_mul_round)
+{
+    for (auto var1 = -32768; var1<32768; var1 += 7) {
+        for (auto var2 = -32768; var2<32768; var2 += 61) {
+            auto const expected = round(l_mult(static_cast<std::int16_t>(var1), static_cast<std::int16_t>(var2)));
+            auto const actual = q_mul_round(q15::from_data(static_cast<std::int16_t>(var1)),
+                    q15::from_data(static_cast<std::int16_t>(var2)));
+            ASSERT_EQ(expected, actual.data()) << var1 << '*' << var2;
+        }
+    }
+}
+
+TEST(utils_tests, q_mul_round_batch)
+{
+    auto const minus_one = numeric_limits<q31>::lowest();
+    q31 const lhs[] = {minus_one, minus_one, .5, q31::from_data(-5), .25};
+    q31 const rhs[] = {minus_one, .5, .5, .5, -.75};
+    q31 output[5];
+    ASSERT_EQ(q_mul_round(std::begin(lhs), std::end(lhs), std::begin(rhs), std::begin(output)), std::end(output));
+    for (auto i = 0; i!=5; ++i) {
+        ASSERT_EQ(output[i], q_mul_round(lhs[i], rhs[i]));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::pow
+
+static_assert(pow(make_fixed<15, 16>(2), make_fixed<15, 16>(10))==1024, "sg14::pow test failed");
+static_assert(pow(make_fixed<15, 16>(16), make_fixed<15, 16>(-.5))==.25, "sg14::pow test failed");
+static_assert(pow(make_fixed<15, 16>(-2), make_fixed<15, 16>(3))==-8, "sg14::pow test failed");
+static_assert(pow(make_fixed<15, 16>(0), make_fixed<15, 16>(-1))==numeric_limits<make_fixed<15, 16>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(make_fixed<15, 16>(-1.5), 3)==-3.375, "sg14::pow test failed");
+static_assert(pow(make_ufixed<8, 8>(.5), -2)==4, "sg14::pow test failed");
+static_assert(pow(make_fixed<15, 16>(3), sg14::const_integer<int, 4>{})==81, "sg14::pow test failed");
+static_assert(pow(make_fixed<7, 0>(-3), sg14::const_integer<int, 5>{})==-128, "sg14::pow test failed");
+
+#if defined(SG14_EXCEPTIONS_ENABLED)
+TEST(utils_tests, pow_exception)
+{
+    ASSERT_THROW(pow(make_fixed<15, 16>(-2), make_fixed<15, 16>(.5)), std::invalid_argument);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // sg14::abs
 